@@ -31,6 +31,8 @@
 
 #include "stri_stringi.h"
 #include "stri_brkiter.h"
+#include <string>
+#include <vector>
 
 
 /** Select Break Iterator
@@ -157,6 +159,44 @@ void StriBrkIterOptions::setLocale(SEXP opts_brkiter) {
 }
 
 
+/** Get Break Iterator's precompiled rules
+ *
+ * @param opts_brkiter named list
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+void StriBrkIterOptions::setRulesBinary(SEXP opts_brkiter) {
+   if (isNull(opts_brkiter)) {
+      return; // leave as-is (empty)
+   }
+
+   if (!Rf_isVectorList(opts_brkiter))
+      Rf_error(MSG__INCORRECT_BRKITER_OPTION_SPEC); // error() allowed here
+
+   R_len_t narg = LENGTH(opts_brkiter);
+   SEXP names = Rf_getAttrib(opts_brkiter, R_NamesSymbol);
+   if (names == R_NilValue || LENGTH(names) != narg)
+      Rf_error(MSG__INCORRECT_BRKITER_OPTION_SPEC); // error() allowed here
+
+   for (R_len_t i=0; i<narg; ++i) {
+      if (STRING_ELT(names, i) == NA_STRING)
+         Rf_error(MSG__INCORRECT_BRKITER_OPTION_SPEC); // error() allowed here
+
+      const char* curname = CHAR(STRING_ELT(names, i));
+      if (!strcmp(curname, "rules_binary")) {
+         SEXP curval = VECTOR_ELT(opts_brkiter, i);
+         if (TYPEOF(curval) != RAWSXP)
+            Rf_error(MSG__ARG_EXPECTED_RAW_NO_COERCION, "rules_binary"); // error() allowed here
+         if (LENGTH(curval) <= 0)
+            Rf_error(MSG__INCORRECT_MATCH_OPTION, "rules_binary"); // error() allowed here
+         this->rules_binary.assign((const char*)RAW(curval), (size_t)LENGTH(curval));
+         this->rules = UnicodeString();
+         return;
+      }
+   }
+}
+
+
 /** Get Break Iterator's skip rule status
  *
  * @param opts_brkiter named list
@@ -230,21 +270,520 @@ void StriBrkIterOptions::setSkipRuleStatus(SEXP opts_brkiter) {
 }
 
 
+#define STRI__BRKITER_CACHE_SIZE 8
+
+
+/** A prototype break iterator with the settings it has been created with
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+struct StriBrkIterCacheEntry {
+   UBreakIteratorType type;
+   std::string locale;    ///< resolved locale ID; empty for custom rules
+   UnicodeString rules;   ///< empty for built-in rules
+   std::string rules_binary; ///< empty unless precompiled rules are used;
+                             ///< referenced (not copied) by proto
+   BreakIterator* proto;  ///< NULL if the slot is free
+};
+
+static StriBrkIterCacheEntry stri__brkiter_cache[STRI__BRKITER_CACHE_SIZE];
+static int stri__brkiter_cache_next = 0; ///< slot to be overwritten next
+
+
+/** Close all the cached break iterators, see stri__brkiter_create()
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+void stri__brkiter_cache_cleanup()
+{
+   for (int k=0; k<STRI__BRKITER_CACHE_SIZE; ++k) {
+      if (stri__brkiter_cache[k].proto) {
+         delete stri__brkiter_cache[k].proto;
+         stri__brkiter_cache[k].proto = NULL;
+      }
+   }
+}
+
+
+/* Layout of ICU's precompiled RBBI rules, see icu55/common/rbbidata.h
+ * and icu55/common/utrie.h (these are not public ICU headers).
+ * Data format version 3 is used by ICU 3.4-59;
+ * ICU 60 dropped the safe point tables.
+ */
+struct StriRBBIDataHeader {
+   uint32_t fMagic;
+   uint8_t  fFormatVersion[4];
+   uint32_t fLength;
+   uint32_t fCatCount;
+   uint32_t fFTable;
+   uint32_t fFTableLen;
+   uint32_t fRTable;
+   uint32_t fRTableLen;
+#if U_ICU_VERSION_MAJOR_NUM < 60
+   uint32_t fSFTable;
+   uint32_t fSFTableLen;
+   uint32_t fSRTable;
+   uint32_t fSRTableLen;
+#endif
+   uint32_t fTrie;
+   uint32_t fTrieLen;
+   uint32_t fRuleSource;
+   uint32_t fRuleSourceLen;
+   uint32_t fStatusTable;
+   uint32_t fStatusTableLen;
+   uint32_t fReserved[6];
+};
+
+#if U_ICU_VERSION_MAJOR_NUM < 60
+struct StriRBBIStateTable {
+   uint32_t fNumStates;
+   uint32_t fRowLen;
+   uint32_t fFlags;
+   uint32_t fReserved;
+   /* followed by fNumStates rows of int16_t fAccepting, fLookAhead,
+      fTagIdx, fReserved and uint16_t fNextState[fCatCount] */
+};
+
+struct StriUTrieHeader {
+   uint32_t signature;
+   uint32_t options;
+   int32_t  indexLength;
+   int32_t  dataLength;
+};
+#endif
+
+
+/** Check whether a section of precompiled RBBI rules lies within the data
+ *
+ * @param offset section offset
+ * @param length section length in bytes
+ * @param total total length of the data
+ * @param align required alignment of the section
+ * @return whether the section is in range
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static inline bool stri__brkiter_binary_section(uint32_t offset,
+   uint32_t length, uint32_t total, uint32_t align)
+{
+   return offset%align == 0 && offset <= total && length <= total-offset;
+}
+
+
+#if U_ICU_VERSION_MAJOR_NUM < 60
+/** Check whether a rule status index is valid, see
+ * RuleBasedBreakIterator::getRuleStatusVec()
+ *
+ * @param status status table
+ * @param n number of status table entries
+ * @param idx index to check
+ * @return whether status[idx] is a count followed by that many values
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static inline bool stri__brkiter_binary_status(const int32_t* status,
+   uint32_t n, int32_t idx)
+{
+   return idx >= 0 && (uint32_t)idx < n &&
+      status[idx] >= 0 && (uint32_t)status[idx] < n-(uint32_t)idx;
+}
+
+
+/** Check a state table of precompiled RBBI rules
+ *
+ * @param table state table
+ * @param length section length in bytes
+ * @param ncat number of character categories
+ * @param status status table
+ * @param nstatus number of status table entries
+ * @return whether all rows, next states and rule status indexes are in range
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static bool stri__brkiter_binary_table(const StriRBBIStateTable* table,
+   uint32_t length, uint32_t ncat, const int32_t* status, uint32_t nstatus)
+{
+   if (length < sizeof(StriRBBIStateTable)) return false;
+   uint32_t nstates = table->fNumStates;
+   uint32_t rowlen  = table->fRowLen;
+   if (rowlen != 4*sizeof(int16_t)+ncat*sizeof(uint16_t)) return false;
+   // START_STATE == 1 is used unconditionally
+   if (nstates < 2 || (double)nstates*rowlen > length-sizeof(StriRBBIStateTable))
+      return false;
+
+   const char* rows = (const char*)(table+1);
+   for (uint32_t s=0; s<nstates; ++s) {
+      const int16_t* row = (const int16_t*)(rows+s*rowlen);
+      if (!stri__brkiter_binary_status(status, nstatus, row[2])) // fTagIdx
+         return false;
+      const uint16_t* next = (const uint16_t*)(row+4);
+      for (uint32_t c=0; c<ncat; ++c)
+         if (next[c] >= nstates) return false;
+   }
+   return true;
+}
+
+
+/** Check the character category trie of precompiled RBBI rules
+ *
+ * Mimics UTRIE_GET16() for all the code points.
+ *
+ * @param trie trie data
+ * @param length section length in bytes
+ * @param ncat number of character categories
+ * @return whether all lookups stay in range and yield valid categories
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static bool stri__brkiter_binary_trie(const StriUTrieHeader* trie,
+   uint32_t length, uint32_t ncat)
+{
+   const int32_t shift = 5, index_shift = 2, block = 1<<shift;
+   const int32_t lead_disp = 0x2800>>shift;
+   if (length < sizeof(StriUTrieHeader) || trie->signature != 0x54726965)
+      return false;
+   if ((trie->options&0xf) != (uint32_t)shift ||
+         ((trie->options>>4)&0xf) != (uint32_t)index_shift ||
+         (trie->options&0x100) != 0) // 16-bit data expected
+      return false;
+
+   // BMP lookups use index entries up to (0xdbff>>shift)+lead_disp
+   int32_t nindex = trie->indexLength, ndata = trie->dataLength;
+   if (nindex < (0xdbff>>shift)+lead_disp+1 || ndata < 1 ||
+         (double)nindex+ndata > (length-sizeof(StriUTrieHeader))/2)
+      return false;
+
+   // the data follow the index
+   const uint16_t* index = (const uint16_t*)(trie+1);
+   int32_t n = nindex+ndata;
+   for (int32_t i=0; i<nindex; ++i)
+      if (((int32_t)index[i]<<index_shift)+block > n) return false;
+
+   if ((index[nindex]&~0x4000) >= ncat) // initial value
+      return false;
+
+   for (int32_t c=0; c<=0xffff; ++c) {
+      int32_t i = (c>>shift)+((c >= 0xd800 && c <= 0xdbff)?lead_disp:0);
+      if ((index[((int32_t)index[i]<<index_shift)+(c&(block-1))]&~0x4000) >= ncat)
+         return false;
+   }
+
+   // supplementary code points: folded lead surrogate values
+   // give offsets (if bit 15 is set) of index blocks for trail surrogates
+   std::vector<bool> checked(0x8000, false);
+   for (int32_t c=0xd800; c<=0xdbff; ++c) {
+      uint16_t v = index[((int32_t)index[c>>shift]<<index_shift)+(c&(block-1))];
+      if (!(v&0x8000)) continue; // initial value
+      int32_t offset = v&0x7fff;
+      if (offset == 0 || checked[offset]) continue;
+      checked[offset] = true;
+      if (offset+(0x400>>shift) > nindex) return false;
+      for (int32_t t=0; t<0x400; ++t) {
+         if ((index[((int32_t)index[offset+(t>>shift)]<<index_shift)+(t&(block-1))]&~0x4000) >= ncat)
+            return false;
+      }
+   }
+   return true;
+}
+#endif
+
+
+/** Check whether precompiled RBBI rules are well-formed
+ *
+ * ICU trusts the data passed to the binary-rules constructor
+ * of RuleBasedBreakIterator: a truncated or otherwise corrupted
+ * raw vector could make it read beyond the buffer.
+ *
+ * All the section bounds are checked. For data format version 3
+ * (ICU < 60, including the bundled ICU 55), also all the state tables,
+ * rule status indexes, the character category trie and the rule source
+ * are verified.
+ *
+ * @param rules_binary data, see stri_brkiter_compile()
+ * @return whether the data may be passed to ICU
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static bool stri__brkiter_binary_check(const std::string& rules_binary)
+{
+   if (rules_binary.size() < sizeof(StriRBBIDataHeader)) return false;
+   const StriRBBIDataHeader* header = (const StriRBBIDataHeader*)rules_binary.data();
+   uint32_t len = header->fLength;
+   if (header->fMagic != 0xb1a0 || len < sizeof(StriRBBIDataHeader) ||
+         len > rules_binary.size())
+      return false;
+
+   if (!stri__brkiter_binary_section(header->fFTable, header->fFTableLen, len, 4) ||
+       !stri__brkiter_binary_section(header->fRTable, header->fRTableLen, len, 4) ||
+#if U_ICU_VERSION_MAJOR_NUM < 60
+       !stri__brkiter_binary_section(header->fSFTable, header->fSFTableLen, len, 4) ||
+       !stri__brkiter_binary_section(header->fSRTable, header->fSRTableLen, len, 4) ||
+#endif
+       !stri__brkiter_binary_section(header->fTrie, header->fTrieLen, len, 4) ||
+       !stri__brkiter_binary_section(header->fRuleSource, header->fRuleSourceLen, len, 2) ||
+       !stri__brkiter_binary_section(header->fStatusTable, header->fStatusTableLen, len, 4))
+      return false;
+
+#if U_ICU_VERSION_MAJOR_NUM < 60
+   const char* data = rules_binary.data();
+   uint32_t ncat = header->fCatCount;
+   if (header->fFormatVersion[0] != 3 || ncat < 3 || ncat >= 0x4000)
+      return false; // categories 1 and 2 denote the start and end of input
+
+   // the forward and reverse tables are used unconditionally
+   if (header->fFTableLen == 0 || header->fRTableLen == 0) return false;
+
+   const int32_t* status = (const int32_t*)(data+header->fStatusTable);
+   uint32_t nstatus = header->fStatusTableLen/sizeof(int32_t);
+   if (!stri__brkiter_binary_status(status, nstatus, 0)) return false;
+
+   uint32_t tables[4][2] = {
+      {header->fFTable,  header->fFTableLen},  {header->fRTable,  header->fRTableLen},
+      {header->fSFTable, header->fSFTableLen}, {header->fSRTable, header->fSRTableLen}
+   };
+   for (int k=0; k<4; ++k) {
+      if (tables[k][1] != 0 && !stri__brkiter_binary_table(
+            (const StriRBBIStateTable*)(data+tables[k][0]), tables[k][1],
+            ncat, status, nstatus))
+         return false;
+   }
+
+   if (!stri__brkiter_binary_trie((const StriUTrieHeader*)(data+header->fTrie),
+         header->fTrieLen, ncat))
+      return false;
+
+   // the rule source is read as a NUL-terminated string;
+   // the terminator may be stored in the padding that follows it
+   const UChar* source = (const UChar*)(data+header->fRuleSource);
+   uint32_t nsource = (len-header->fRuleSource)/sizeof(UChar);
+   uint32_t i = 0;
+   while (i < nsource && source[i] != 0) ++i;
+   if (i == nsource) return false;
+#endif
+
+   return true;
+}
+
+
+/** Create a new break iterator
+ *
+ * Loading locale data and compiling rules is costly, therefore
+ * prototypes for the most recently used settings are cached
+ * and the caller gets their clones.
+ *
+ * @param type break iterator type, ignored if \code{rules} are given
+ * @param locale locale ID, NULL for default, ignored if \code{rules} are given
+ * @param rules custom rules or an empty string
+ * @param rules_binary precompiled rules (see stri_brkiter_compile())
+ *        or an empty string; if given, other arguments are ignored
+ * @return a new object, to be deleted by the caller before
+ *        the cache slot is reused (e.g., before returning to R)
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+BreakIterator* stri__brkiter_create(UBreakIteratorType type,
+   const char* locale, const UnicodeString& rules,
+   const std::string& rules_binary)
+{
+   const char* resolved_locale = "";
+   if (rules.isEmpty() && rules_binary.empty())
+      resolved_locale = (locale)?locale:uloc_getDefault();
+
+   StriBrkIterCacheEntry* entry = NULL;
+   for (int k=0; k<STRI__BRKITER_CACHE_SIZE; ++k) {
+      StriBrkIterCacheEntry* cur = &stri__brkiter_cache[k];
+      if (!cur->proto || cur->rules_binary != rules_binary)
+         continue;
+      if (!rules_binary.empty() || (cur->rules == rules &&
+            (!rules.isEmpty() || (cur->type == type && cur->locale == resolved_locale)))) {
+         entry = cur;
+         break;
+      }
+   }
+
+   if (!entry) {
+      entry = &stri__brkiter_cache[stri__brkiter_cache_next];
+      stri__brkiter_cache_next = (stri__brkiter_cache_next+1)%STRI__BRKITER_CACHE_SIZE;
+      if (entry->proto) { delete entry->proto; entry->proto = NULL; }
+      entry->type   = type;
+      entry->locale = resolved_locale;
+      entry->rules  = rules;
+      entry->rules_binary = rules_binary;
+
+      UErrorCode status = U_ZERO_ERROR;
+      BreakIterator* proto = NULL;
+      if (!entry->rules_binary.empty()) {
+         if (!stri__brkiter_binary_check(entry->rules_binary))
+            throw StriException(MSG__INCORRECT_BRKITER_BINARY);
+         // the data are NOT copied by ICU: entry->rules_binary must not
+         // change as long as the prototype (or any of its clones) exists
+         proto = (BreakIterator*) new RuleBasedBreakIterator(
+            (const uint8_t*)entry->rules_binary.data(),
+            (uint32_t)entry->rules_binary.size(), status
+         );
+      }
+      else if (!rules.isEmpty()) {
+         UParseError parseErr;
+         proto = (BreakIterator*) new RuleBasedBreakIterator(
+            UnicodeString(rules), parseErr, status
+         );
+      }
+      else {
+         Locale loc = Locale::createFromName(resolved_locale);
+         switch (type) {
+         case UBRK_CHARACTER: // character
+            proto = (BreakIterator*)BreakIterator::createCharacterInstance(loc, status);
+            break;
+         case UBRK_LINE: // line_break
+            proto = (BreakIterator*)BreakIterator::createLineInstance(loc, status);
+            break;
+         case UBRK_SENTENCE: // sentence
+            proto = (BreakIterator*)BreakIterator::createSentenceInstance(loc, status);
+            break;
+         case UBRK_WORD: // word
+            proto = (BreakIterator*)BreakIterator::createWordInstance(loc, status);
+            break;
+         default:
+            throw StriException(MSG__INTERNAL_ERROR);
+         }
+      }
+      STRI__CHECKICUSTATUS_THROW(status, { if (proto) delete proto; })
+      if (!proto) throw StriException(MSG__MEM_ALLOC_ERROR);
+      entry->proto = proto; // the slot stays free on error
+   }
+
+   BreakIterator* brkiter = entry->proto->clone(); // shares the rule data
+   if (!brkiter) throw StriException(MSG__MEM_ALLOC_ERROR);
+   return brkiter;
+}
+
+
+/** Create a new break iterator with the current settings
+ *
+ * @return a new object, to be deleted by the caller
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+BreakIterator* StriBrkIterOptions::createIterator() const
+{
+   return stri__brkiter_create(type, locale, rules, rules_binary);
+}
+
+
+/** Character classes used by StriRuleBasedBreakIterator::nextASCIIWord()
+ *
+ * Word_Break property values of ASCII characters, see UAX #29.
+ * COLON is MidLetter and COMMERCIAL AT is ALetter only in some ICU versions
+ * and locales; strings with them are always processed by ICU.
+ */
+enum StriASCIIWordClass {
+   STRI__WB_OTHER=0,
+   STRI__WB_ALETTER,      // A-Z a-z
+   STRI__WB_NUMERIC,      // 0-9
+   STRI__WB_EXTENDNUMLET, // _
+   STRI__WB_MIDNUMLET,    // .
+   STRI__WB_SINGLEQUOTE,  // '
+   STRI__WB_MIDNUM,       // , ;
+   STRI__WB_FALLBACK      // : @ or non-ASCII
+};
+
+
+/** Get the Word_Break class of a byte
+ *
+ * @param c a byte
+ * @return StriASCIIWordClass value
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static inline int stri__ascii_word_class(char c)
+{
+   if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')) return STRI__WB_ALETTER;
+   if (c >= '0' && c <= '9') return STRI__WB_NUMERIC;
+   switch (c) {
+      case '_':  return STRI__WB_EXTENDNUMLET;
+      case '.':  return STRI__WB_MIDNUMLET;
+      case '\'': return STRI__WB_SINGLEQUOTE;
+      case ',':
+      case ';':  return STRI__WB_MIDNUM;
+      case ':':
+      case '@':  return STRI__WB_FALLBACK;
+      default:   return (U8_IS_SINGLE(c))?STRI__WB_OTHER:STRI__WB_FALLBACK;
+   }
+}
+
+
+/** Can nextASCIIWord() be used instead of ICU?
+ *
+ * This is the case for word boundaries with the default rules
+ * and only `skip_word_none` set, as in stri_count_words()
+ * and stri_extract_all_words(); locales with variants
+ * or keywords (e.g., en_US_POSIX) may tailor the rules.
+ *
+ * @return logical value
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+bool StriRuleBasedBreakIterator::isASCIIWordEligible()
+{
+   if (asciiWordState < 0) {
+      asciiWordState = 0;
+      if (type == UBRK_WORD && rules.isEmpty() && rules_binary.empty() && skip_size == 2 &&
+            skip_rules[0] == UBRK_WORD_NONE && skip_rules[1] == UBRK_WORD_NONE_LIMIT) {
+         Locale loc = Locale::createFromName(locale);
+         UErrorCode status = U_ZERO_ERROR;
+         StringEnumeration* keywords = loc.createKeywords(status);
+         bool has_keywords = (keywords != NULL);
+         if (keywords) delete keywords;
+         if (!loc.isBogus() && loc.getVariant()[0] == '\0' && !has_keywords && U_SUCCESS(status))
+            asciiWordState = 1;
+      }
+   }
+   return asciiWordState > 0;
+}
+
+
 /**
  *
  * @ version 0.4-1 (Marek Gagolewski, 2014-12-03)
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    ASCII word segmenter: ICU is not used for ASCII strings if possible
  */
 void StriRuleBasedBreakIterator::setupMatcher(const char* _searchStr, R_len_t _searchLen)
 {
-   if (!rbiterator) open();
-
    this->searchStr = _searchStr;
    this->searchLen = _searchLen;
    this->searchPos = BreakIterator::DONE;
 
+   this->asciiWordMode = false;
+   if (isASCIIWordEligible()) {
+      this->asciiWordMode = true;
+      for (R_len_t j=0; j<_searchLen; ++j) {
+         if (stri__ascii_word_class(_searchStr[j]) == STRI__WB_FALLBACK) {
+            this->asciiWordMode = false;
+            break;
+         }
+      }
+   }
+
+   if (!this->asciiWordMode)
+      setupICU();
+}
+
+
+/** Pass the current string to ICU
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    separated from setupMatcher()
+ */
+void StriRuleBasedBreakIterator::setupICU()
+{
+   if (!rbiterator) open();
+   this->asciiWordMode = false;
+
    UErrorCode status = U_ZERO_ERROR;
    this->searchText = utext_openUTF8(this->searchText,
-      _searchStr, _searchLen, &status);
+      this->searchStr, this->searchLen, &status);
    STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
 
    status = U_ZERO_ERROR;
@@ -253,6 +792,69 @@ void StriRuleBasedBreakIterator::setupMatcher(const char* _searchStr, R_len_t _s
 }
 
 
+/** Find the next word in an ASCII string
+ *
+ * Gives the same results as ICU's word BreakIterator with
+ * boundaries of status UBRK_WORD_NONE skipped:
+ * a word is a maximal sequence of letters, digits, and underscores
+ * (WB5, WB8-10, WB13a-b), also joined by a single
+ * MidNumLet or Single_Quote between two letters (WB6-7) or
+ * MidNum, MidNumLet, or Single_Quote between two digits (WB11-12).
+ * A lone underscore is not a word.
+ *
+ * @param start [out] the word's start
+ * @return whether a word has been found; if so, searchPos is its end
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+bool StriRuleBasedBreakIterator::nextASCIIWord(R_len_t& start)
+{
+   R_len_t j = searchPos;
+   while (j < searchLen) {
+      int cls = stri__ascii_word_class(searchStr[j]);
+      if (cls != STRI__WB_ALETTER && cls != STRI__WB_NUMERIC && cls != STRI__WB_EXTENDNUMLET) {
+         ++j;
+         continue;
+      }
+
+      R_len_t wstart = j;
+      bool alnum = false;
+      while (j < searchLen) {
+         cls = stri__ascii_word_class(searchStr[j]);
+         if (cls == STRI__WB_ALETTER || cls == STRI__WB_NUMERIC) {
+            alnum = true;
+            ++j;
+         }
+         else if (cls == STRI__WB_EXTENDNUMLET) {
+            ++j;
+         }
+         else if (j > wstart && j+1 < searchLen && (
+               cls == STRI__WB_MIDNUMLET || cls == STRI__WB_SINGLEQUOTE || cls == STRI__WB_MIDNUM)) {
+            int prev = stri__ascii_word_class(searchStr[j-1]);
+            int next = stri__ascii_word_class(searchStr[j+1]);
+            if (prev == STRI__WB_ALETTER && next == STRI__WB_ALETTER && cls != STRI__WB_MIDNUM)
+               j += 2;
+            else if (prev == STRI__WB_NUMERIC && next == STRI__WB_NUMERIC)
+               j += 2;
+            else
+               break;
+         }
+         else
+            break;
+      }
+
+      if (alnum || j-wstart >= 2) {
+         start = wstart;
+         searchPos = j;
+         return true;
+      }
+   }
+
+   searchPos = searchLen;
+   return false;
+}
+
+
 /** Should a boundary be ignored by a Break Iterator
  *
  * @param brkskip vector of indices [even, odd) -- ids to skip
@@ -286,9 +888,16 @@ bool StriRuleBasedBreakIterator::ignoreBoundary() {
 /**
  *
  * @ version 0.4-1 (Marek Gagolewski, 2014-12-03)
+ *
+ * @version 1.1.6 (agent, 2026-10-18) ASCII word segmenter
  */
 void StriRuleBasedBreakIterator::first()
 {
+   if (asciiWordMode) {
+      this->searchPos = 0;
+      return;
+   }
+
 #ifndef NDBEGUG
    if (!rbiterator)
       throw StriException("!NDEBUG: StriRuleBasedBreakIterator::first");
@@ -306,9 +915,16 @@ void StriRuleBasedBreakIterator::first()
 /**
  *
  * @ version 0.4-1 (Marek Gagolewski, 2014-12-03)
+ *
+ * @version 1.1.6 (agent, 2026-10-18) ASCII word segmenter
  */
 bool StriRuleBasedBreakIterator::next()
 {
+   if (asciiWordMode) {
+      R_len_t start;
+      return nextASCIIWord(start);
+   }
+
    while ((this->searchPos = rbiterator->next()) != BreakIterator::DONE) {
       if (!ignoreBoundary())
          return true;
@@ -320,9 +936,17 @@ bool StriRuleBasedBreakIterator::next()
 /**
  *
  * @ version 0.4-1 (Marek Gagolewski, 2014-12-03)
+ *
+ * @version 1.1.6 (agent, 2026-10-18) ASCII word segmenter
  */
 bool StriRuleBasedBreakIterator::next(std::pair<R_len_t, R_len_t>& bdr)
 {
+   if (asciiWordMode) {
+      if (!nextASCIIWord(bdr.first)) return false;
+      bdr.second = searchPos;
+      return true;
+   }
+
    R_len_t lastPos = searchPos;
    while ((searchPos = rbiterator->next()) != BreakIterator::DONE) {
       if (!ignoreBoundary()) {
@@ -340,9 +964,14 @@ bool StriRuleBasedBreakIterator::next(std::pair<R_len_t, R_len_t>& bdr)
 /**
  *
  * @ version 0.4-1 (Marek Gagolewski, 2014-12-05)
+ *
+ * @version 1.1.6 (agent, 2026-10-18) ASCII word segmenter
  */
 void StriRuleBasedBreakIterator::last()
 {
+   if (asciiWordMode)
+      setupICU(); // backward iteration is not supported by nextASCIIWord()
+
 #ifndef NDBEGUG
    if (!rbiterator)
       throw StriException("!NDEBUG: StriRuleBasedBreakIterator::last");
@@ -379,3 +1008,46 @@ bool StriRuleBasedBreakIterator::previous(std::pair<R_len_t, R_len_t>& bdr)
    while (searchPos != BreakIterator::DONE);
    return false;
 }
+
+
+/** Compile custom break iteration rules
+ *
+ * The resulting binary form depends on the ICU version and
+ * the platform's endianness.
+ *
+ * @param rules single string
+ * @return raw vector
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+SEXP stri_brkiter_compile(SEXP rules)
+{
+   PROTECT(rules = stri_prepare_arg_string_1(rules, "rules"));
+   if (STRING_ELT(rules, 0) == NA_STRING) {
+      UNPROTECT(1);
+      Rf_error(MSG__ARG_EXPECTED_NOT_NA, "rules"); // error() allowed here
+   }
+
+   RuleBasedBreakIterator* rbiterator = NULL;
+   STRI__ERROR_HANDLER_BEGIN(1)
+   StriContainerUTF16 rules_cont(rules, 1);
+
+   UErrorCode status = U_ZERO_ERROR;
+   UParseError parseErr;
+   rbiterator = new RuleBasedBreakIterator(rules_cont.get(0), parseErr, status);
+   STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+
+   uint32_t rules_length = 0;
+   const uint8_t* rules_data = rbiterator->getBinaryRules(rules_length);
+   if (!rules_data) throw StriException(MSG__INTERNAL_ERROR);
+
+   SEXP ret;
+   STRI__PROTECT(ret = Rf_allocVector(RAWSXP, (R_len_t)rules_length));
+   memcpy(RAW(ret), rules_data, (size_t)rules_length);
+
+   delete rbiterator;
+   rbiterator = NULL;
+   STRI__UNPROTECT_ALL
+   return ret;
+   STRI__ERROR_HANDLER_END({ if (rbiterator) delete rbiterator; })
+}
@@ -36,11 +36,17 @@
 #include <deque>
 #include <utility>
 #include <vector>
+#include <string>
 #include <unicode/brkiter.h>
 #include <unicode/uloc.h>
 #include <unicode/locid.h>
 
 
+BreakIterator* stri__brkiter_create(UBreakIteratorType type,
+   const char* locale, const UnicodeString& rules,
+   const std::string& rules_binary=std::string());
+
+
 /**
  * A class to manage a break iterator's options
  *
@@ -49,12 +55,15 @@
  * @version 1.1.3 (Marek Gagolewski, 2017-01-07) UBRK_COUNT deprecated
  *
  * @version 1.1.6 (Marek Gagolewski, 2017-04-22) Add support for RBBI
+ *
+ * @version 1.1.6 (agent, 2026-10-18) createIterator(); rules_binary
  */
 class StriBrkIterOptions {
    protected:
 
       const char* locale;      // R_alloc'd
       UnicodeString rules;
+      std::string rules_binary; // precompiled rules, see stri_brkiter_compile()
       UBreakIteratorType type;
       int32_t* skip_rules;     // R_alloc'd
       R_len_t  skip_size;      // number of elements in skip_rules
@@ -72,6 +81,7 @@ class StriBrkIterOptions {
       void setType(SEXP opts_brkiter, const char* default_type);
       void setLocale(SEXP opts_brkiter);
       void setSkipRuleStatus(SEXP opts_brkiter);
+      void setRulesBinary(SEXP opts_brkiter);
 
 
    public:
@@ -86,7 +96,10 @@ class StriBrkIterOptions {
          setLocale(opts_brkiter);
          setSkipRuleStatus(opts_brkiter);
          setType(opts_brkiter, default_type);
+         setRulesBinary(opts_brkiter);
       }
+
+      BreakIterator* createIterator() const;
 };
 
 
@@ -100,6 +113,8 @@ class StriBrkIterOptions {
  * @version 1.1.3 (Marek Gagolewski, 2017-01-07) UBRK_COUNT deprecated
  *
  * @version 1.1.6 (Marek Gagolewski, 2017-04-22) Add support for RBBI
+ *
+ * @version 1.1.6 (agent, 2026-10-18) clone a cached prototype
  */
 class StriUBreakIterator : public StriBrkIterOptions {
    private:
@@ -110,32 +125,8 @@ class StriUBreakIterator : public StriBrkIterOptions {
 #ifndef NDEBUG
          if (uiterator) throw StriException("!NDEBUG: StriUBreakIterator::open()");
 #endif
-         UErrorCode status = U_ZERO_ERROR;
-         if (!rules.isEmpty()) {
-            UParseError parseErr;
-            uiterator = ubrk_openRules(rules.getTerminatedBuffer(),
-                                       -1/*null-terminated*/, NULL, 0,
-                                       &parseErr, &status);
-         }
-         else {
-            switch (type) {
-            case UBRK_CHARACTER: // character
-               uiterator = ubrk_open(UBRK_CHARACTER, locale, NULL, 0, &status);
-               break;
-            case UBRK_LINE: // line_break
-               uiterator = ubrk_open(UBRK_LINE, locale, NULL, 0, &status);
-               break;
-            case UBRK_SENTENCE: // sentence
-               uiterator = ubrk_open(UBRK_SENTENCE, locale, NULL, 0, &status);
-               break;
-            case UBRK_WORD: // word
-               uiterator = ubrk_open(UBRK_WORD, locale, NULL, 0, &status);
-               break;
-            default:
-               throw StriException(MSG__INTERNAL_ERROR);
-            }
-         }
-         STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+         // a UBreakIterator is a BreakIterator in disguise, see ICU's ubrk.cpp
+         uiterator = (UBreakIterator*)createIterator();
       }
 
 
@@ -194,6 +185,9 @@ class StriUBreakIterator : public StriBrkIterOptions {
  * separate class
  *
  * @version 1.1.6 (Marek Gagolewski, 2017-04-22) Add support for RBBI
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    clone a cached prototype; ASCII word segmenter
  */
 class StriRuleBasedBreakIterator : public StriBrkIterOptions {
    private:
@@ -203,6 +197,8 @@ class StriRuleBasedBreakIterator : public StriBrkIterOptions {
       R_len_t searchPos; // may be BreakIterator::DONE
       const char* searchStr; // owned by caller
       R_len_t searchLen; // in bytes
+      int asciiWordState; // -1 - not determined yet, 0 - no, 1 - yes
+      bool asciiWordMode; // use nextASCIIWord() for the current string?
 
       void setEmptyOpts() {
          rbiterator = NULL;
@@ -210,40 +206,20 @@ class StriRuleBasedBreakIterator : public StriBrkIterOptions {
          searchPos = BreakIterator::DONE;
          searchStr = NULL;
          searchLen = 0;
+         asciiWordState = -1;
+         asciiWordMode = false;
       }
 
       void open() {
-         UErrorCode status = U_ZERO_ERROR;
-         Locale loc = Locale::createFromName(locale);
-         if (!rules.isEmpty()) {
-            UParseError parseErr;
-            rbiterator = (BreakIterator*) new RuleBasedBreakIterator(
-               UnicodeString(rules), parseErr, status
-            );
-         }
-         else {
-            switch (type) {
-            case UBRK_CHARACTER: // character
-               rbiterator = (BreakIterator*)BreakIterator::createCharacterInstance(loc, status);
-               break;
-            case UBRK_LINE: // line_break
-               rbiterator = (BreakIterator*)BreakIterator::createLineInstance(loc, status);
-               break;
-            case UBRK_SENTENCE: // sentence
-               rbiterator = (BreakIterator*)BreakIterator::createSentenceInstance(loc, status);
-               break;
-            case UBRK_WORD: // word
-               rbiterator = (BreakIterator*)BreakIterator::createWordInstance(loc, status);
-               break;
-            default:
-               throw StriException(MSG__INTERNAL_ERROR);
-            }
-         }
-         STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+         rbiterator = createIterator();
       }
 
       bool ignoreBoundary();
 
+      bool isASCIIWordEligible();
+      void setupICU();
+      bool nextASCIIWord(R_len_t& start);
+
    public:
 
       StriRuleBasedBreakIterator()
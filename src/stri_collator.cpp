@@ -33,6 +33,131 @@
 #include "stri_stringi.h"
 #include <unicode/ucol.h>
 #include <unicode/usearch.h>
+#include <unicode/uloc.h>
+#include <string>
+
+
+#define STRI__UCOL_CACHE_SIZE 4
+#define STRI__UCOL_NOPTS 7
+
+
+/** A prototype Collator with the settings it has been created with
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+struct StriUcolCacheEntry {
+   std::string locale; ///< resolved locale ID
+   UColAttributeValue opts[STRI__UCOL_NOPTS];
+   UCollator* col; ///< NULL if the slot is free
+};
+
+static StriUcolCacheEntry stri__ucol_cache[STRI__UCOL_CACHE_SIZE];
+static int stri__ucol_cache_next = 0; ///< slot to be overwritten next
+
+
+/** Clone a Collator [internal]
+ *
+ * @param col prototype
+ * @param status [out]
+ * @return a new Collator, to be closed with ucol_close()
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static UCollator* stri__ucol_clone(const UCollator* col, UErrorCode* status)
+{
+#if U_ICU_VERSION_MAJOR_NUM >= 71
+   return ucol_clone(col, status);
+#else
+   return ucol_safeClone(col, NULL, NULL, status);
+#endif
+}
+
+
+/** Close all the cached Collators, see stri__ucol_open()
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+void stri__ucol_cache_cleanup()
+{
+   for (int k=0; k<STRI__UCOL_CACHE_SIZE; ++k) {
+      if (stri__ucol_cache[k].col) {
+         ucol_close(stri__ucol_cache[k].col);
+         stri__ucol_cache[k].col = NULL;
+      }
+   }
+}
+
+
+/** Get a Collator with given settings from the cache
+ *
+ * A prototype Collator is created on cache miss,
+ * the caller always gets its clone.
+ *
+ * WARNING: this fuction is allowed to call the error() function.
+ *
+ * @param locale locale ID or NULL for default
+ * @param opts STRI__UCOL_NOPTS attribute values, in the order of
+ *        UCOL_STRENGTH, UCOL_FRENCH_COLLATION, UCOL_ALTERNATE_HANDLING,
+ *        UCOL_CASE_FIRST, UCOL_CASE_LEVEL, UCOL_NORMALIZATION_MODE,
+ *        UCOL_NUMERIC_COLLATION; UCOL_DEFAULT leaves the default value
+ * @return a Collator object that should be closed with ucol_close() after use
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static UCollator* stri__ucol_open_cached(const char* locale, const UColAttributeValue* opts)
+{
+   static const UColAttribute attrs[STRI__UCOL_NOPTS] = {
+      UCOL_STRENGTH, UCOL_FRENCH_COLLATION, UCOL_ALTERNATE_HANDLING,
+      UCOL_CASE_FIRST, UCOL_CASE_LEVEL, UCOL_NORMALIZATION_MODE,
+      UCOL_NUMERIC_COLLATION
+   };
+
+   // the default locale may change between calls, see stri_locale_set()
+   const char* resolved_locale = (locale)?locale:uloc_getDefault();
+
+   for (int k=0; k<STRI__UCOL_CACHE_SIZE; ++k) {
+      StriUcolCacheEntry* entry = &stri__ucol_cache[k];
+      if (!entry->col || entry->locale != resolved_locale)
+         continue;
+      bool same = true;
+      for (int j=0; same && j<STRI__UCOL_NOPTS; ++j)
+         same = (entry->opts[j] == opts[j]);
+      if (!same)
+         continue;
+
+      UErrorCode status = U_ZERO_ERROR;
+      UCollator* col = stri__ucol_clone(entry->col, &status);
+      STRI__CHECKICUSTATUS_RFERROR(status, { if (col) ucol_close(col); }) // error() allowed here
+      return col;
+   }
+
+   // create a prototype collator
+   UErrorCode status = U_ZERO_ERROR;
+   UCollator* proto = ucol_open(locale, &status);
+   STRI__CHECKICUSTATUS_RFERROR(status, { if (proto) ucol_close(proto); }) // error() allowed here
+
+   for (int j=0; j<STRI__UCOL_NOPTS; ++j) {
+      if (opts[j] == UCOL_DEFAULT) continue;
+      status = U_ZERO_ERROR;
+      ucol_setAttribute(proto, attrs[j], opts[j], &status);
+      STRI__CHECKICUSTATUS_RFERROR(status, { ucol_close(proto); }) // error() allowed here
+   }
+
+   status = U_ZERO_ERROR;
+   UCollator* col = stri__ucol_clone(proto, &status);
+   STRI__CHECKICUSTATUS_RFERROR(status, { ucol_close(proto); if (col) ucol_close(col); }) // error() allowed here
+
+   StriUcolCacheEntry* entry = &stri__ucol_cache[stri__ucol_cache_next];
+   stri__ucol_cache_next = (stri__ucol_cache_next+1)%STRI__UCOL_CACHE_SIZE;
+   if (entry->col) ucol_close(entry->col);
+   entry->col = proto;
+   entry->locale = resolved_locale;
+   for (int j=0; j<STRI__UCOL_NOPTS; ++j)
+      entry->opts[j] = opts[j];
+
+   return col;
+}
+
 
 /**
  * Create & set up an ICU Collator
@@ -61,6 +186,9 @@
  *
  * @version 0.4-1 (Marek Gagolewski, 2014-12-08)
  *    #23: add `overlap` option
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    return a clone of a cached prototype Collator
  */
 UCollator* stri__ucol_open(SEXP opts_collator)
 {
@@ -70,10 +198,10 @@ UCollator* stri__ucol_open(SEXP opts_collator)
    R_len_t narg = isNull(opts_collator)?0:LENGTH(opts_collator);
 
    if (narg <= 0) { // no custom settings - use default Collator
-      UErrorCode status = U_ZERO_ERROR;
-      UCollator* col = ucol_open(NULL, &status);
-      STRI__CHECKICUSTATUS_RFERROR(status, {/* do nothing special on err */}) // error() allowed here
-      return col;
+      UColAttributeValue opts[STRI__UCOL_NOPTS];
+      for (int j=0; j<STRI__UCOL_NOPTS; ++j)
+         opts[j] = UCOL_DEFAULT;
+      return stri__ucol_open_cached(NULL, opts);
    }
 
    SEXP names = Rf_getAttrib(opts_collator, R_NamesSymbol);
@@ -133,59 +261,10 @@ UCollator* stri__ucol_open(SEXP opts_collator)
       }
    }
 
-   // create collator
-   UErrorCode status = U_ZERO_ERROR;
-   UCollator* col = ucol_open(opt_LOCALE, &status);
-   STRI__CHECKICUSTATUS_RFERROR(status, { /* nothing special on err */ }) // error() allowed here
-
-   // set other opts
-//   if (opt_OVERLAP != UCOL_OFF) {
-//      status = U_ZERO_ERROR;
-//      ucol_setAttribute(col, UCOL_OVERLAP, opt_OVERLAP, &status);
-//      STRI__CHECKICUSTATUS_RFERROR(status, { ucol_close(col); }) // error() allowed here
-//   }
-
-   if (opt_STRENGTH != UCOL_DEFAULT) {
-      status = U_ZERO_ERROR;
-      ucol_setAttribute(col, UCOL_STRENGTH, opt_STRENGTH, &status);
-      STRI__CHECKICUSTATUS_RFERROR(status, { ucol_close(col); }) // error() allowed here
-   }
-
-   if (opt_FRENCH_COLLATION != UCOL_DEFAULT) {
-      status = U_ZERO_ERROR;
-      ucol_setAttribute(col, UCOL_FRENCH_COLLATION, opt_FRENCH_COLLATION, &status);
-      STRI__CHECKICUSTATUS_RFERROR(status, { ucol_close(col); }) // error() allowed here
-   }
-
-   if (opt_ALTERNATE_HANDLING != UCOL_DEFAULT) {
-      status = U_ZERO_ERROR;
-      ucol_setAttribute(col, UCOL_ALTERNATE_HANDLING, opt_ALTERNATE_HANDLING, &status);
-      STRI__CHECKICUSTATUS_RFERROR(status, { ucol_close(col); }) // error() allowed here
-   }
-
-   if (opt_CASE_FIRST != UCOL_DEFAULT) {
-      status = U_ZERO_ERROR;
-      ucol_setAttribute(col, UCOL_CASE_FIRST, opt_CASE_FIRST, &status);
-      STRI__CHECKICUSTATUS_RFERROR(status, { ucol_close(col); }) // error() allowed here
-   }
-
-   if (opt_CASE_LEVEL != UCOL_DEFAULT) {
-      status = U_ZERO_ERROR;
-      ucol_setAttribute(col, UCOL_CASE_LEVEL, opt_CASE_LEVEL, &status);
-      STRI__CHECKICUSTATUS_RFERROR(status, { ucol_close(col); }) // error() allowed here
-   }
-
-   if (opt_NORMALIZATION_MODE != UCOL_DEFAULT) {
-      status = U_ZERO_ERROR;
-      ucol_setAttribute(col, UCOL_NORMALIZATION_MODE, opt_NORMALIZATION_MODE, &status);
-      STRI__CHECKICUSTATUS_RFERROR(status, { ucol_close(col); }) // error() allowed here
-   }
-
-   if (opt_NUMERIC_COLLATION != UCOL_DEFAULT) {
-      status = U_ZERO_ERROR;
-      ucol_setAttribute(col, UCOL_NUMERIC_COLLATION, opt_NUMERIC_COLLATION, &status);
-      STRI__CHECKICUSTATUS_RFERROR(status, { ucol_close(col); }) // error() allowed here
-   }
-
-   return col;
+   UColAttributeValue opts[STRI__UCOL_NOPTS] = {
+      opt_STRENGTH, opt_FRENCH_COLLATION, opt_ALTERNATE_HANDLING,
+      opt_CASE_FIRST, opt_CASE_LEVEL, opt_NORMALIZATION_MODE,
+      opt_NUMERIC_COLLATION
+   };
+   return stri__ucol_open_cached(opt_LOCALE, opts);
 }
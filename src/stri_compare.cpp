@@ -105,6 +105,9 @@
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    identical CHARSXPs are always equal - skip memcmp
  */
 SEXP stri_cmp_codepoints(SEXP e1, SEXP e2, int _negate)
 {
@@ -117,7 +120,9 @@ SEXP stri_cmp_codepoints(SEXP e1, SEXP e2, int _negate)
 
    STRI__ERROR_HANDLER_BEGIN(2)
 
-   R_len_t vectorize_length = stri__recycling_rule(true, 2, LENGTH(e1), LENGTH(e2));
+   R_len_t e1_length = LENGTH(e1);
+   R_len_t e2_length = LENGTH(e2);
+   R_len_t vectorize_length = stri__recycling_rule(true, 2, e1_length, e2_length);
 
    StriContainerUTF8 e1_cont(e1, vectorize_length);
    StriContainerUTF8 e2_cont(e2, vectorize_length);
@@ -133,6 +138,12 @@ SEXP stri_cmp_codepoints(SEXP e1, SEXP e2, int _negate)
          continue;
       }
 
+      // R caches CHARSXPs: the same pointer => the same bytes & encoding
+      if (STRING_ELT(e1, i%e1_length) == STRING_ELT(e2, i%e2_length)) {
+         ret_tab[i] = !_negate;
+         continue;
+      }
+
       R_len_t     cur1_n = e1_cont.get(i).length();
       const char* cur1_s = e1_cont.get(i).c_str();
       R_len_t     cur2_n = e2_cont.get(i).length();
@@ -32,6 +32,8 @@
 
 #include "stri_stringi.h"
 #include "stri_container_usearch.h"
+#include <unicode/uset.h>
+#include <string>
 
 
 /**
@@ -42,8 +44,13 @@ StriContainerUStringSearch::StriContainerUStringSearch()
    : StriContainerUTF16()
 {
    this->lastMatcherIndex = -1;
+   this->lastMatcher = NULL;
    this->str = NULL;
    this->col = NULL;
+   this->asciiFoldPrepared = false;
+   this->asciiFoldEnabled = false;
+   this->asciiMatcher = NULL;
+   this->asciiMatcherIndex = -1;
 }
 
 
@@ -59,6 +66,10 @@ StriContainerUStringSearch::StriContainerUStringSearch(SEXP rstr, R_len_t _nrecy
    this->lastMatcherIndex = -1;
    this->lastMatcher = NULL;
    this->col = _col;
+   this->asciiFoldPrepared = false;
+   this->asciiFoldEnabled = false;
+   this->asciiMatcher = NULL;
+   this->asciiMatcherIndex = -1;
 }
 
 
@@ -71,6 +82,10 @@ StriContainerUStringSearch::StriContainerUStringSearch(StriContainerUStringSearc
    this->lastMatcherIndex = -1;
    this->lastMatcher = NULL;
    this->col = container.col;
+   this->asciiFoldPrepared = false;
+   this->asciiFoldEnabled = false;
+   this->asciiMatcher = NULL;
+   this->asciiMatcherIndex = -1;
 }
 
 
@@ -81,6 +96,10 @@ StriContainerUStringSearch& StriContainerUStringSearch::operator=(StriContainerU
    this->lastMatcherIndex = -1;
    this->lastMatcher = NULL;
    this->col = container.col;
+   this->asciiFoldPrepared = false;
+   this->asciiFoldEnabled = false;
+   this->asciiMatcher = NULL;
+   this->asciiMatcherIndex = -1;
    return *this;
 }
 
@@ -94,6 +113,14 @@ StriContainerUStringSearch::~StriContainerUStringSearch()
       usearch_close(lastMatcher);
       lastMatcher = NULL;
    }
+   for (std::map<SEXP, UStringSearch*>::iterator it = matcherCache.begin();
+         it != matcherCache.end(); ++it)
+      usearch_close(it->second);
+   matcherCache.clear();
+   if (asciiMatcher) {
+      delete asciiMatcher;
+      asciiMatcher = NULL;
+   }
    col = NULL;
    // col is owned by the caller
 }
@@ -116,17 +143,36 @@ UStringSearch* StriContainerUStringSearch::getMatcher(R_len_t i, const UnicodeSt
 
 /** the returned matcher shall not be deleted by the user
  *
- * it is assumed that \code{vectorize_next()} is used:
- * for \code{i >= this->n} the last matcher is returned
- *
+ * Up to \code{STRI__USEARCH_CACHE_MAX} matchers are compiled
+ * and kept (one for each distinct pattern CHARSXP); only their texts
+ * are reset later on. Further patterns share a single matcher,
+ * which is recompiled as needed.
  *
  * @param i index
  * @param searchStr string to search in
  * @param searchStr_len string length in UChars
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    cache compiled matchers
  */
 UStringSearch* StriContainerUStringSearch::getMatcher(R_len_t i, const UChar* searchStr, int32_t searchStr_len)
 {
-   if (!lastMatcher) {
+   SEXP key = STRING_ELT(this->sexp, i % n);
+   UStringSearch* matcher = NULL;
+
+   std::map<SEXP, UStringSearch*>::iterator it = matcherCache.find(key);
+   if (it != matcherCache.end()) {
+      matcher = it->second; // matcher reuse
+   }
+   else if ((R_len_t)matcherCache.size() < STRI__USEARCH_CACHE_MAX) {
+      UErrorCode status = U_ZERO_ERROR;
+      matcher = usearch_openFromCollator(this->get(i).getBuffer(), this->get(i).length(),
+            searchStr, searchStr_len, col, NULL, &status);
+      STRI__CHECKICUSTATUS_THROW(status, {if (matcher) usearch_close(matcher);})
+      matcherCache[key] = matcher;
+      return matcher; // text already set
+   }
+   else if (!lastMatcher) {
       this->lastMatcherIndex = (i % n);
       UErrorCode status = U_ZERO_ERROR;
       lastMatcher = usearch_openFromCollator(this->get(i).getBuffer(), this->get(i).length(),
@@ -134,20 +180,193 @@ UStringSearch* StriContainerUStringSearch::getMatcher(R_len_t i, const UChar* se
       STRI__CHECKICUSTATUS_THROW(status, {usearch_close(lastMatcher); lastMatcher = NULL;})
       return lastMatcher;
    }
-
-   if (this->lastMatcherIndex == (i % n)) {
-      // do nothing => matcher reuse
-   }
    else {
-      this->lastMatcherIndex = (i % n);
-      UErrorCode status = U_ZERO_ERROR;
-      usearch_setPattern(lastMatcher, this->get(i).getBuffer(), this->get(i).length(), &status);
-      STRI__CHECKICUSTATUS_THROW(status, {usearch_close(lastMatcher); lastMatcher = NULL;})
+      matcher = lastMatcher;
+      if (this->lastMatcherIndex != (i % n)) {
+         this->lastMatcherIndex = (i % n);
+         UErrorCode status = U_ZERO_ERROR;
+         usearch_setPattern(lastMatcher, this->get(i).getBuffer(), this->get(i).length(), &status);
+         STRI__CHECKICUSTATUS_THROW(status, {usearch_close(lastMatcher); lastMatcher = NULL;})
+      }
    }
 
    UErrorCode status = U_ZERO_ERROR;
-   usearch_setText(lastMatcher, searchStr, searchStr_len, &status);
-   STRI__CHECKICUSTATUS_THROW(status, {usearch_close(lastMatcher); lastMatcher = NULL;})
+   usearch_setText(matcher, searchStr, searchStr_len, &status);
+   STRI__CHECKICUSTATUS_THROW(status, {/* matcher is owned by this */})
+
+   return matcher;
+}
+
+
+/** Determine which ASCII characters may be searched for bytewise
+ *
+ * At the primary and secondary strength, as long as the case level
+ * and numeric collation are off, a "simple" ASCII character
+ * (one that is not ignorable and takes no part in an ASCII-only contraction)
+ * generates exactly one collation element. Then \code{usearch}
+ * matches a pattern iff the sequences of the characters' equivalence
+ * classes are identical, and this is what a byte search on strings
+ * with each character replaced by the smallest (code-wise) equivalent
+ * one does.
+ *
+ * Note that the root collation has no ASCII contractions or expansions,
+ * so we only inspect the tailored set. CR is never simple:
+ * \code{usearch} does not split the CR LF grapheme cluster.
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+void StriContainerUStringSearch::prepareASCIIFolding()
+{
+   asciiFoldPrepared = true;
+   asciiFoldEnabled = false;
+   for (int c=0; c<128; ++c)
+      asciiFold[c] = -1;
+
+   if (!col) return;
+
+   UErrorCode status = U_ZERO_ERROR;
+   UColAttributeValue strength = ucol_getAttribute(col, UCOL_STRENGTH, &status);
+   UColAttributeValue caselevel = ucol_getAttribute(col, UCOL_CASE_LEVEL, &status);
+   UColAttributeValue numeric = ucol_getAttribute(col, UCOL_NUMERIC_COLLATION, &status);
+   if (U_FAILURE(status)) return; // just use usearch
+   if ((strength != UCOL_PRIMARY && strength != UCOL_SECONDARY)
+         || caselevel == UCOL_ON || numeric == UCOL_ON)
+      return;
+
+   for (int c=0; c<128; ++c)
+      asciiFold[c] = c;
+   asciiFold[ASCII_CR] = -1;
+
+   USet* tailored = ucol_getTailoredSet(col, &status);
+   if (U_FAILURE(status)) {
+      if (tailored) uset_close(tailored);
+      return;
+   }
+   int32_t nitems = uset_getItemCount(tailored);
+   UChar buf[16];
+   for (int32_t k=0; k<nitems; ++k) {
+      UChar32 start, end;
+      status = U_ZERO_ERROR;
+      int32_t len = uset_getItem(tailored, k, &start, &end, buf, 16, &status);
+      if (U_FAILURE(status)) { // a very long string - be conservative
+         uset_close(tailored);
+         return;
+      }
+      if (len <= 1) continue; // a range of code points or a single UChar
+      bool allascii = true;
+      for (int32_t j=0; allascii && j<len; ++j)
+         allascii = (buf[j] < 128);
+      if (allascii) {
+         for (int32_t j=0; j<len; ++j)
+            asciiFold[buf[j]] = -1; // a contraction, e.g., "ch" in Czech
+      }
+   }
+   uset_close(tailored);
+
+   // characters are equivalent iff their sort keys are identical:
+   // one ucol_getSortKey() call per character instead of O(128^2) ucol_strcoll()s
+   uint8_t key[64];
+   int32_t keylen = ucol_getSortKey(col, NULL, 0, key, sizeof(key));
+   if (keylen <= 0 || keylen > (int32_t)sizeof(key)) return;
+   std::string key_empty((const char*)key, keylen);
+   std::map<std::string, int> key_first; // sort key -> smallest character
+   for (int c=0; c<128; ++c) {
+      if (asciiFold[c] < 0) continue;
+      UChar uc = (UChar)c;
+      keylen = ucol_getSortKey(col, &uc, 1, key, sizeof(key));
+      if (keylen <= 0 || keylen > (int32_t)sizeof(key)) {
+         asciiFold[c] = -1; // be conservative
+         continue;
+      }
+      std::string key_cur((const char*)key, keylen);
+      if (key_cur == key_empty) {
+         asciiFold[c] = -1; // ignorable
+         continue;
+      }
+      std::map<std::string, int>::iterator it = key_first.find(key_cur);
+      if (it == key_first.end())
+         key_first[key_cur] = c;
+      else
+         asciiFold[c] = it->second;
+   }
+
+   asciiFoldEnabled = true;
+}
+
+
+/** Map a UTF-16 string to its ASCII folding, see prepareASCIIFolding()
+ *
+ * @param s string
+ * @param n length of \code{s}
+ * @param buf [out] NUL-terminated folded string
+ * @return false if \code{s} has some non-ASCII or non-simple characters
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+bool StriContainerUStringSearch::foldASCII(const UChar* s, int32_t n, String8buf& buf) const
+{
+   for (int32_t j=0; j<n; ++j) {
+      if (s[j] >= 128 || asciiFold[s[j]] < 0)
+         return false;
+   }
+
+   buf.resize(n, false);
+   char* data = buf.data();
+   for (int32_t j=0; j<n; ++j)
+      data[j] = (char)asciiFold[s[j]];
+   data[n] = '\0';
+   return true;
+}
+
+
+/** Get a byte search matcher for the ASCII fast path
+ *
+ * The returned matcher (do not delete it) is already reset,
+ * and gives the same match positions as \code{getMatcher()} would
+ * (UTF-16 indices == byte indices for ASCII strings).
+ *
+ * it is assumed that \code{vectorize_next()} is used:
+ * for \code{i >= this->n} the last matcher is returned
+ *
+ * @param i index
+ * @param searchStr string to search in
+ * @return NULL if the fast path cannot be used, call getMatcher() then
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+StriByteSearchMatcher* StriContainerUStringSearch::getMatcherASCII(R_len_t i, const UnicodeString& searchStr)
+{
+   if (!asciiFoldPrepared)
+      prepareASCIIFolding();
+
+   if (!asciiFoldEnabled)
+      return NULL;
+
+   if (asciiMatcherIndex < 0
+         || STRING_ELT(this->sexp, asciiMatcherIndex) != STRING_ELT(this->sexp, i % n)) {
+      if (asciiMatcher) {
+         delete asciiMatcher;
+         asciiMatcher = NULL;
+      }
+      asciiMatcherIndex = (i % n);
+      if (!foldASCII(this->get(i).getBuffer(), this->get(i).length(), asciiPattern))
+         return NULL; // asciiMatcher == NULL marks an unfoldable pattern
+
+      R_len_t patternLen = this->get(i).length();
+      if (patternLen == 1)
+         asciiMatcher = new StriByteSearchMatcher1(asciiPattern.data(), patternLen, false);
+      else if (patternLen < 16)
+         asciiMatcher = new StriByteSearchMatcherShort(asciiPattern.data(), patternLen, false);
+      else
+         asciiMatcher = new StriByteSearchMatcherKMP(asciiPattern.data(), patternLen, false);
+   }
+
+   if (!asciiMatcher)
+      return NULL;
+
+   if (!foldASCII(searchStr.getBuffer(), searchStr.length(), asciiText))
+      return NULL;
 
-   return lastMatcher;
+   asciiMatcher->reset(asciiText.data(), searchStr.length());
+   return asciiMatcher;
 }
@@ -34,9 +34,17 @@
 #define __stri_container_usearch_h
 
 #include "stri_container_utf16.h"
+#include "stri_string8buf.h"
+#include "stri_bytesearch_matcher.h"
 #include <unicode/coll.h>
 #include <unicode/ucol.h>
 #include <unicode/stsearch.h>
+#include <map>
+
+
+/** max number of compiled \code{UStringSearch} objects
+ *  kept by a single StriContainerUStringSearch */
+#define STRI__USEARCH_CACHE_MAX 256
 
 
 /**
@@ -52,14 +60,31 @@
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-01)
  *          getMatcher() now also accepts UChar*
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    getMatcherASCII(): a fast path for ASCII-only strings searched at the
+ *    primary or secondary strength; getMatcher() keeps a compiled
+ *    \code{UStringSearch} for each distinct pattern
  */
 class StriContainerUStringSearch : public StriContainerUTF16 {
 
    private:
 
       UCollator* col; ///< collator, owned by creator
-      UStringSearch* lastMatcher; ///< recently used \code{UStringSearch}
+      UStringSearch* lastMatcher; ///< recently used \code{UStringSearch} (not cached)
       R_len_t lastMatcherIndex;  ///< used by vectorize_getMatcher
+      std::map<SEXP, UStringSearch*> matcherCache; ///< pattern's CHARSXP -> matcher
+
+      int asciiFold[128]; ///< ASCII code -> smallest collation-equivalent code, -1 if not simple
+      bool asciiFoldPrepared; ///< has prepareASCIIFolding() been called?
+      bool asciiFoldEnabled; ///< is getMatcherASCII() ever applicable?
+      StriByteSearchMatcher* asciiMatcher; ///< recently used ASCII matcher
+      R_len_t asciiMatcherIndex; ///< pattern index of asciiMatcher, -1 if folding failed
+      String8buf asciiPattern; ///< folded pattern used by asciiMatcher
+      String8buf asciiText; ///< folded haystack used by asciiMatcher
+
+      void prepareASCIIFolding();
+      bool foldASCII(const UChar* s, int32_t n, String8buf& buf) const;
 
 
    public:
@@ -71,6 +96,7 @@ class StriContainerUStringSearch : public StriContainerUTF16 {
       StriContainerUStringSearch& operator=(StriContainerUStringSearch& container);
       UStringSearch* getMatcher(R_len_t i, const UnicodeString& searchStr);
       UStringSearch* getMatcher(R_len_t i, const UChar* searchStr, int32_t searchStr_len);
+      StriByteSearchMatcher* getMatcherASCII(R_len_t i, const UnicodeString& searchStr);
 };
 
 #endif
@@ -73,6 +73,9 @@ StriContainerUTF16::StriContainerUTF16(R_len_t _nrecycle)
  *
  * @version 1.0.6 (Marek Gagolewski, 2017-05-25)
  *    #270 latin-1 is windows-1252 on Windows
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    ASCII, Latin-1 -> UTF-16 without ICU converters (Latin-1: except on Windows)
  */
 StriContainerUTF16::StriContainerUTF16(SEXP rstr, R_len_t _nrecycle, bool _shallowrecycle)
 {
@@ -82,7 +85,7 @@ StriContainerUTF16::StriContainerUTF16(SEXP rstr, R_len_t _nrecycle, bool _shall
       throw StriException("DEBUG: !isString in StriContainerUTF16::StriContainerUTF16(SEXP rstr)");
 #endif
    R_len_t nrstr = LENGTH(rstr);
-   this->init_Base(nrstr, _nrecycle, _shallowrecycle); // calling LENGTH(rstr) fails on constructor call
+   this->init_Base(nrstr, _nrecycle, _shallowrecycle, rstr); // calling LENGTH(rstr) fails on constructor call
 
    if (this->n == 0)
       return; /* nothing more to do */
@@ -96,7 +99,6 @@ StriContainerUTF16::StriContainerUTF16(SEXP rstr, R_len_t _nrecycle, bool _shall
    without any conversion table data. The common library contains
    code to handle several important encodings algorithmically: US-ASCII,
    ISO-8859-1, UTF-7/8/16/32, SCSU, BOCU-1, CESU-8, and IMAP-mailbox-name */
-   StriUcnv ucnvASCII("US-ASCII");
 #if defined(_WIN32) || defined(_WIN64)
    // #270: latin-1 is windows-1252 on Windows
    StriUcnv ucnvLatin1("WINDOWS-1252");
@@ -112,13 +114,21 @@ StriContainerUTF16::StriContainerUTF16(SEXP rstr, R_len_t _nrecycle, bool _shall
       }
 
       if (IS_ASCII(curs)) {
+         // Version 2: widen directly, see stri__latin1_to_utf16()
+         R_len_t curs_n = LENGTH(curs);
+         this->str[i].remove(); // unset bogus (NA)
+         UChar* buf = this->str[i].getBuffer(curs_n);
+         if (!buf) throw StriException(MSG__MEM_ALLOC_ERROR);
+         stri__latin1_to_utf16(CHAR(curs), curs_n, buf);
+         this->str[i].releaseBuffer(curs_n);
+
          // Version 1:
-         UConverter* ucnv = ucnvASCII.getConverter();
-         UErrorCode status = U_ZERO_ERROR;
-         this->str[i].setTo(
-            UnicodeString((const char*)CHAR(curs), (int32_t)LENGTH(curs), ucnv, status)
-         );
-         STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+         // UConverter* ucnv = ucnvASCII.getConverter();
+         // UErrorCode status = U_ZERO_ERROR;
+         // this->str[i].setTo(
+         //    UnicodeString((const char*)CHAR(curs), (int32_t)LENGTH(curs), ucnv, status)
+         // );
+         // STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
 
          // Performance improvement attempt #1:
          // this->str[i] = new UnicodeString(UnicodeString::fromUTF8(CHAR(curs)));
@@ -130,7 +140,7 @@ StriContainerUTF16::StriContainerUTF16(SEXP rstr, R_len_t _nrecycle, bool _shall
          // This wasn't faster than the ucnvASCII approach.
 
          // Performance improvement attempt #3:
-         // slightly slower than ucnvASCII
+         // slightly slower than ucnvASCII (with ICU 52 and per-call converters)
          // R_len_t curs_n = LENGTH(curs);
          // const char* curs_s = CHAR(curs);
          // this->str[i].remove(); // unset bogus (NA)
@@ -145,12 +155,22 @@ StriContainerUTF16::StriContainerUTF16(SEXP rstr, R_len_t _nrecycle, bool _shall
          this->str[i].setTo(UnicodeString::fromUTF8(CHAR(curs)));
       }
       else if (IS_LATIN1(curs)) {
+#if defined(_WIN32) || defined(_WIN64)
          UConverter* ucnv = ucnvLatin1.getConverter();
          UErrorCode status = U_ZERO_ERROR;
          this->str[i].setTo(
             UnicodeString((const char*)CHAR(curs), (int32_t)LENGTH(curs), ucnv, status)
          );
          STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+#else
+         // ISO-8859-1 -> UTF-16 is purely algorithmic
+         R_len_t curs_n = LENGTH(curs);
+         this->str[i].remove(); // unset bogus (NA)
+         UChar* buf = this->str[i].getBuffer(curs_n);
+         if (!buf) throw StriException(MSG__MEM_ALLOC_ERROR);
+         stri__latin1_to_utf16(CHAR(curs), curs_n, buf);
+         this->str[i].releaseBuffer(curs_n);
+#endif
       }
       else if (IS_BYTES(curs)) {
          throw StriException(MSG__BYTESENC);
@@ -55,6 +55,9 @@ StriContainerUTF8::StriContainerUTF8()
  *
  * @version 1.0.6 (Marek Gagolewski, 2017-05-25)
  *    #270 latin-1 is windows-1252 on Windows
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    Latin-1 -> UTF-8 without ICU converters (except on Windows)
  */
 StriContainerUTF8::StriContainerUTF8(SEXP rstr, R_len_t _nrecycle, bool _shallowrecycle)
 {
@@ -116,9 +119,13 @@ StriContainerUTF8::StriContainerUTF8(SEXP rstr, R_len_t _nrecycle, bool _shallow
       else {
 //             LATIN1 ------- OR ------ Native encoding
 
-         UConverter* ucnvCurrent;
+         UConverter* ucnvCurrent = NULL;
          if (IS_LATIN1(curs)) {
+#if defined(_WIN32) || defined(_WIN64)
             ucnvCurrent = ucnvLatin1.getConverter();
+#else
+            // ISO-8859-1 -> UTF-8 is purely algorithmic, see below
+#endif
          }
          else { // "unknown" (native) encoding
             // an "unknown" (native) encoding may be set to UTF-8 (speedup)
@@ -154,6 +161,13 @@ StriContainerUTF8::StriContainerUTF8(SEXP rstr, R_len_t _nrecycle, bool _shallow
             outbuf.resize(outbufsize, false);
          }
 
+         if (!ucnvCurrent) {
+            // Latin-1 -> UTF-8, at most 2 bytes per char
+            R_len_t outrealsize = stri__latin1_to_utf8(CHAR(curs), LENGTH(curs), outbuf.data());
+            this->str[i].initialize(outbuf.data(), outrealsize, true/*memalloc*/, false/*killbom*/, false/*isASCII*/);
+            continue;
+         }
+
 
          // version 1: use ucnv's pivot buffer (slower than v2)
 //               UErrorCode status = U_ZERO_ERROR;
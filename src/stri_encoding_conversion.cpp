@@ -38,6 +38,212 @@
 #include "stri_string8buf.h"
 #include "stri_ucnv.h"
 #include <vector>
+#include <climits>
+
+#define STRI__ENCODE_PIVOT_SIZE 1024
+
+
+/** Encodings for which stri_encode() may bypass ICU's converters
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+enum StriEncodeType {
+   STRI__ENCODE_OTHER = 0,
+   STRI__ENCODE_UTF8,
+   STRI__ENCODE_LATIN1,
+   STRI__ENCODE_ASCII,
+   STRI__ENCODE_UTF16LE,
+   STRI__ENCODE_UTF16BE,
+   STRI__ENCODE_UTF32LE,
+   STRI__ENCODE_UTF32BE
+};
+
+
+/** Determine which direct conversion routine may be used [internal]
+ *
+ * @param ucnv converter
+ * @return one of STRI__ENCODE_* constants
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static StriEncodeType stri__encode_type(UConverter* ucnv)
+{
+   UErrorCode status = U_ZERO_ERROR;
+   const char* name = ucnv_getName(ucnv, &status);
+   if (U_FAILURE(status) || !name) return STRI__ENCODE_OTHER;
+
+   if (!strcmp(name, "UTF-8"))      return STRI__ENCODE_UTF8;
+   if (!strcmp(name, "ISO-8859-1")) return STRI__ENCODE_LATIN1;
+   if (!strcmp(name, "US-ASCII"))   return STRI__ENCODE_ASCII;
+   if (!strcmp(name, "UTF-16LE"))   return STRI__ENCODE_UTF16LE;
+   if (!strcmp(name, "UTF-16BE"))   return STRI__ENCODE_UTF16BE;
+   if (!strcmp(name, "UTF-32LE"))   return STRI__ENCODE_UTF32LE;
+   if (!strcmp(name, "UTF-32BE"))   return STRI__ENCODE_UTF32BE;
+   return STRI__ENCODE_OTHER;
+}
+
+
+/** Convert a string without ICU's converters [internal]
+ *
+ * Handles the cases where the output is known to be exactly the same
+ * as the one ICU would generate and no substitution is needed:
+ * the source must be valid UTF-8, Latin-1, or pure ASCII text,
+ * while the target is UTF-8, UTF-16LE/BE, or UTF-32LE/BE
+ * (or any of the three 8-bit ones for identity or ASCII-only conversions).
+ *
+ * @param from_type source encoding, see stri__encode_type()
+ * @param to_type target encoding, see stri__encode_type()
+ * @param s source string
+ * @param n number of bytes in \code{s}
+ * @param buf [out] output buffer
+ * @return number of bytes written to \code{buf}
+ *    or -1 if the direct conversion is not applicable
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static R_len_t stri__encode_direct(StriEncodeType from_type, StriEncodeType to_type,
+   const char* s, R_len_t n, String8buf& buf)
+{
+   if (from_type != STRI__ENCODE_UTF8 && from_type != STRI__ENCODE_LATIN1
+         && from_type != STRI__ENCODE_ASCII)
+      return -1;
+   if (to_type == STRI__ENCODE_OTHER)
+      return -1;
+
+   // number of code points if s is valid UTF-8, == n iff s is pure ASCII
+   R_len_t ncp = stri__utf8_count_valid(s, n);
+   bool is_ascii = (ncp == n);
+
+   if (from_type == STRI__ENCODE_UTF8 && ncp < 0)
+      return -1; // let ICU substitute and warn
+   if (from_type == STRI__ENCODE_ASCII && !is_ascii)
+      return -1;
+
+   bool to_8bit = (to_type == STRI__ENCODE_UTF8 || to_type == STRI__ENCODE_LATIN1
+      || to_type == STRI__ENCODE_ASCII);
+   if (from_type == to_type || (is_ascii && to_8bit)) {
+      buf.resize(n, false/*destroy contents*/);
+      memcpy(buf.data(), s, (size_t)n);
+      return n;
+   }
+   if (to_type == STRI__ENCODE_LATIN1 || to_type == STRI__ENCODE_ASCII)
+      return -1; // some code points may be unmappable
+
+   if (from_type == STRI__ENCODE_LATIN1 && to_type == STRI__ENCODE_UTF8) {
+      if (n >= INT_MAX/2) throw StriException(MSG__MEM_ALLOC_ERROR);
+      buf.resize(n*2, false/*destroy contents*/);
+      return stri__latin1_to_utf8(s, n, buf.data());
+   }
+
+   // the output takes at most 4 bytes per input byte
+   if ((double)n*4.0 >= (double)INT_MAX) return -1;
+   buf.resize(n*4, false/*destroy contents*/);
+   uint8_t* out = (uint8_t*)buf.data();
+   R_len_t k = 0;
+   R_len_t j = 0;
+   while (j < n) {
+      UChar32 c;
+      if (from_type == STRI__ENCODE_UTF8) {
+         U8_NEXT_UNSAFE(s, j, c); // validated above
+      }
+      else
+         c = (UChar32)(uint8_t)s[j++];
+
+      switch (to_type) {
+         case STRI__ENCODE_UTF8:
+            U8_APPEND_UNSAFE(out, k, c);
+            break;
+
+         case STRI__ENCODE_UTF16LE:
+         case STRI__ENCODE_UTF16BE: {
+            UChar u[2];
+            int nu = 0;
+            if (c <= 0xffff) u[nu++] = (UChar)c;
+            else {
+               u[nu++] = U16_LEAD(c);
+               u[nu++] = U16_TRAIL(c);
+            }
+            for (int z=0; z<nu; ++z) {
+               if (to_type == STRI__ENCODE_UTF16LE) {
+                  out[k++] = (uint8_t)(u[z]);
+                  out[k++] = (uint8_t)(u[z]>>8);
+               }
+               else {
+                  out[k++] = (uint8_t)(u[z]>>8);
+                  out[k++] = (uint8_t)(u[z]);
+               }
+            }
+            break;
+         }
+
+         case STRI__ENCODE_UTF32LE:
+            out[k++] = (uint8_t)(c);
+            out[k++] = (uint8_t)(c>>8);
+            out[k++] = (uint8_t)(c>>16);
+            out[k++] = (uint8_t)(c>>24);
+            break;
+
+         case STRI__ENCODE_UTF32BE:
+            out[k++] = (uint8_t)(c>>24);
+            out[k++] = (uint8_t)(c>>16);
+            out[k++] = (uint8_t)(c>>8);
+            out[k++] = (uint8_t)(c);
+            break;
+
+         default:
+            throw StriException(MSG__INTERNAL_ERROR);
+      }
+   }
+   return k;
+}
+
+
+/** Convert a string with ICU's converters [internal]
+ *
+ * Uses ucnv_convertEx() with a fixed-size pivot buffer,
+ * so no UTF-16 copy of the whole string is created.
+ * The output buffer is grown as necessary.
+ *
+ * @param uconv_from source converter
+ * @param uconv_to target converter
+ * @param s source string
+ * @param n number of bytes in \code{s}
+ * @param buf [in/out] output buffer
+ * @return number of bytes written to \code{buf}
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static R_len_t stri__encode_stream(UConverter* uconv_from, UConverter* uconv_to,
+   const char* s, R_len_t n, String8buf& buf)
+{
+   UChar pivot[STRI__ENCODE_PIVOT_SIZE];
+   UChar* pivot_source = pivot;
+   UChar* pivot_target = pivot;
+   const char* source = s;
+   const char* source_limit = s+n;
+   R_len_t k = 0;
+   UBool reset = TRUE; // reset both converters and the pivot on the 1st call
+   while (true) {
+      char* target = buf.data()+k;
+      UErrorCode status = U_ZERO_ERROR;
+      ucnv_convertEx(uconv_to, uconv_from,
+         &target, buf.data()+buf.size(), &source, source_limit,
+         pivot, &pivot_source, &pivot_target, pivot+STRI__ENCODE_PIVOT_SIZE,
+         reset, TRUE/*flush*/, &status);
+      k = (R_len_t)(target-buf.data());
+      reset = FALSE;
+
+      if (status == U_BUFFER_OVERFLOW_ERROR) {
+         // continue where we stopped, with a larger buffer
+         if ((double)buf.size()*2.0 >= (double)INT_MAX)
+            throw StriException(MSG__MEM_ALLOC_ERROR);
+         buf.resize(buf.size()*2, true/*retain contents*/);
+         continue;
+      }
+      STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+      return k;
+   }
+}
 
 
 /** Convert from UTF-32
@@ -213,6 +419,9 @@ SEXP stri_enc_toutf32(SEXP str)
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    validate via stri__utf8_find_invalid
  */
 SEXP stri_enc_toutf8(SEXP str, SEXP is_unknown_8bit, SEXP validate)
 {
@@ -293,15 +502,15 @@ SEXP stri_enc_toutf8(SEXP str, SEXP is_unknown_8bit, SEXP validate)
          SEXP curs = STRING_ELT(ret, i);
          if (curs == NA_STRING) continue;
 
+         if (IS_ASCII(curs)) continue; // valid, nothing to do
+
          const char* s = CHAR(curs);
          R_len_t sn = LENGTH(curs);
-         R_len_t j = 0;
-         UChar32 c = 0;
-         while (c >= 0 && j < sn) {
-            U8_NEXT(s, j, sn, c);
-         }
+         if (stri__utf8_find_invalid(s, sn) < 0)
+            continue; // valid, nothing to do
 
-         if (c >= 0) continue; // valid, nothing to do
+         R_len_t j;
+         UChar32 c;
 
          if (LOGICAL(validate)[0] == NA_LOGICAL) {
             Rf_warning(MSG__INVALID_CODE_POINT_REPLNA);
@@ -561,6 +770,10 @@ SEXP stri_encode_from_marked(SEXP str, SEXP to, SEXP to_raw)
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    convert via a fixed-size pivot buffer, see stri__encode_stream();
+ *    some pairs of encodings are handled directly, see stri__encode_direct()
  */
 SEXP stri_encode(SEXP str, SEXP from, SEXP to, SEXP to_raw)
 {
@@ -597,15 +810,17 @@ SEXP stri_encode(SEXP str, SEXP from, SEXP to, SEXP to_raw)
    STRI__PROTECT(ret = Rf_allocVector(to_raw_logical?VECSXP:STRSXP, str_n));
 
 
-   // estimate required buf size
+   // initial buf size, extended if necessary
    R_len_t bufsize = 0;
    for (R_len_t i=0; i<str_n; ++i) {
       if (!str_cont.isNA(i) && str_cont.get(i).length() > bufsize)
          bufsize = str_cont.get(i).length();
    }
-   bufsize = bufsize*4; // this is just an estimate (for 8bit->utf8 conversions)
    String8buf buf(bufsize);
 
+   StriEncodeType from_type = stri__encode_type(uconv_from);
+   StriEncodeType to_type   = stri__encode_type(uconv_to);
+
    for (R_len_t i=0; i<str_n; ++i) {
       if (str_cont.isNA(i)) {
          if (to_raw_logical) SET_VECTOR_ELT(ret, i, R_NilValue);
@@ -616,36 +831,9 @@ SEXP stri_encode(SEXP str, SEXP from, SEXP to, SEXP to_raw)
       const char* curs = str_cont.get(i).c_str();
       R_len_t curn     = str_cont.get(i).length();
 
-      UErrorCode status = U_ZERO_ERROR;
-      UnicodeString encs(curs, curn, uconv_from, status); // FROM -> UTF-16 [this is the slow part]
-      STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-
-      R_len_t curn_tmp = encs.length();
-      const UChar* curs_tmp = encs.getBuffer(); // The buffer contents is (probably) not NUL-terminated.
-      if (!curs_tmp) {
-         throw StriException(MSG__INTERNAL_ERROR);
-      }
-
-      R_len_t bufneed = UCNV_GET_MAX_BYTES_FOR_STRING(curn_tmp, ucnv_getMaxCharSize(uconv_to));
-      // "The calculated size is guaranteed to be sufficient for this conversion."
-      buf.resize(bufneed, false/*destroy contents*/); // grows or stays as it was
-
-      status = U_ZERO_ERROR;
-//      bufneed = encs.extract(buf.data(), buf.size(), uconv_to, status); // UTF-16 -> TO
-      ucnv_resetFromUnicode(uconv_to);
-      bufneed = ucnv_fromUChars(uconv_to, buf.data(), buf.size(), curs_tmp,
-         curn_tmp, &status);
-      if (bufneed <= buf.size()) {
-         STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-      }
-      else {// larger buffer needed [this shouldn't happen?]
-//         warning("buf extending");
-         buf.resize(bufneed, false/*destroy contents*/);
-         status = U_ZERO_ERROR;
-         bufneed = ucnv_fromUChars(uconv_to, buf.data(), buf.size(), curs_tmp,
-            curn_tmp, &status);
-         STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-      }
+      R_len_t bufneed = stri__encode_direct(from_type, to_type, curs, curn, buf);
+      if (bufneed < 0)
+         bufneed = stri__encode_stream(uconv_from, uconv_to, curs, curn, buf);
 
       if (to_raw_logical) {
          SEXP outobj;
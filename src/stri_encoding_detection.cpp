@@ -40,6 +40,7 @@
 #include <map>
 #include <vector>
 #include <algorithm>
+#include <cstring>
 #include "stri_container_listraw.h"
 #include "stri_container_logical.h"
 #include "stri_ucnv.h"
@@ -144,19 +145,19 @@ double stri__enc_check_ascii(const char* str_cur_s, R_len_t str_cur_n, bool get_
  *
  * @version 0.1-?? (Marek Gagolewski, 2013-08-13)
  *          confidence calculation basing on ICU's i18n/csrutf8.cpp
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *          exact check via stri__utf8_find_invalid
  */
 double stri__enc_check_utf8(const char* str_cur_s, R_len_t str_cur_n, bool get_confidence)
 {
    if (!get_confidence) {
-      UChar32 c;
-      for (R_len_t j=0; j < str_cur_n; ) {
-         if (str_cur_s[j] == 0)
-            return 0.0; // definitely not valid UTF-8
-
-         U8_NEXT(str_cur_s, j, str_cur_n, c);
-         if (c < 0) // ICU utf8.h doc for U8_NEXT: c -> output UChar32 variable, set to <0 in case of an error
-            return 0.0; // definitely not valid UTF-8
-      }
+      if (memchr(str_cur_s, 0, (size_t)str_cur_n))
+         return 0.0; // definitely not valid UTF-8
+
+      // one-pass validator, skips ASCII runs a word at a time
+      if (stri__utf8_find_invalid(str_cur_s, str_cur_n) >= 0)
+         return 0.0; // definitely not valid UTF-8
       return 1.0;
    }
    else {
@@ -115,7 +115,8 @@ SEXP stri_stats_latex(SEXP str);
 
 // trans_transliterate.cpp:
 SEXP stri_trans_list();
-SEXP stri_trans_general(SEXP str, SEXP id);
+SEXP stri_trans_general(SEXP str, SEXP id, SEXP nthreads);
+SEXP stri_trans_general_rules(SEXP str, SEXP rules, SEXP forward, SEXP nthreads);
 
 // utils.cpp
 SEXP stri_list2matrix(SEXP x, SEXP byrow=Rf_ScalarLogical(FALSE),
@@ -132,6 +133,12 @@ SEXP stri_enc_toutf8(SEXP str, SEXP is_unknown_8bit=Rf_ScalarLogical(FALSE),
 SEXP stri_enc_toascii(SEXP str);
 
 
+// files.cpp:
+SEXP stri_read_lines(SEXP fname, SEXP encoding=R_NilValue);
+SEXP stri_write_lines(SEXP str, SEXP fname, SEXP encoding=R_NilValue,
+   SEXP sep=Rf_mkString("\n"), SEXP bom=Rf_ScalarLogical(FALSE));
+
+
 // encoding_detection.cpp:
 SEXP stri_enc_detect2(SEXP str, SEXP loc=R_NilValue);
 SEXP stri_enc_detect(SEXP str, SEXP filter_angle_brackets=Rf_ScalarLogical(FALSE));
@@ -297,6 +304,7 @@ SEXP stri_locate_all_boundaries(SEXP str,
    SEXP omit_no_match=Rf_ScalarLogical(FALSE), SEXP opts_brkiter=R_NilValue);
 SEXP stri_locate_first_boundaries(SEXP str, SEXP opts_brkiter=R_NilValue);
 SEXP stri_locate_last_boundaries(SEXP str, SEXP opts_brkiter=R_NilValue);
+SEXP stri_brkiter_compile(SEXP rules);
 SEXP stri_split_boundaries(SEXP str, SEXP n=Rf_ScalarInteger(-1),
    SEXP tokens_only=Rf_ScalarLogical(FALSE),
    SEXP simplify=Rf_ScalarLogical(FALSE), SEXP opts_brkiter=R_NilValue);
@@ -59,6 +59,7 @@
 #include <unicode/brkiter.h>
 #include <unicode/rbbi.h>
 #include <unicode/timezone.h>
+#include <unicode/calendar.h>
 using namespace icu;
 
 #define USE_RINTERNALS
@@ -0,0 +1,452 @@
+/* This file is part of the 'stringi' package for R.
+ * Copyright (c) 2013-2017, Marek Gagolewski and other contributors.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "stri_stringi.h"
+#include "stri_container_utf8.h"
+#include "stri_string8buf.h"
+#include "stri_ucnv.h"
+#include <cstdio>
+#include <climits>
+
+
+#define STRI__FILES_CHUNK_SIZE 65536
+#define STRI__FILES_PIVOT_SIZE 1024
+
+
+/** Append a text line to a growing character vector [internal]
+ *
+ * The vector at the top of the protection stack is replaced
+ * by a longer one if necessary.
+ *
+ * @param ret [in/out] character vector, protected, on the top of the stack
+ * @param nret [in/out] number of elements already set
+ * @param s UTF-8 string
+ * @param n number of bytes in s
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static void stri__read_lines_push(SEXP& ret, R_len_t& nret, const char* s, R_len_t n)
+{
+   if (nret >= LENGTH(ret)) {
+      R_len_t ret_n = LENGTH(ret);
+      if (ret_n >= INT_MAX/2) throw StriException(MSG__MEM_ALLOC_ERROR);
+      SEXP ret2;
+      PROTECT(ret2 = Rf_allocVector(STRSXP, 2*ret_n));
+      for (R_len_t i=0; i<ret_n; ++i)
+         SET_STRING_ELT(ret2, i, STRING_ELT(ret, i));
+      UNPROTECT(2); // ret2, ret
+      PROTECT(ret = ret2);
+   }
+   SET_STRING_ELT(ret, nret++, Rf_mkCharLenCE(s, n, CE_UTF8));
+}
+
+
+/** Split UTF-8 text into lines [internal]
+ *
+ * The rules are the same as in stri_split_lines1():
+ * CR, LF, CR+LF, VT, FF, NEL, LS, and PS are line separators.
+ *
+ * @param s well-formed UTF-8 text; NUL bytes result in an error
+ * @param n number of bytes in s
+ * @param from bytes before this position are known not to
+ *    contain any line separators (they have been scanned before)
+ * @param eof is s the final part of the input?
+ * @param ret [in/out] see stri__read_lines_push()
+ * @param nret [in/out] see stri__read_lines_push()
+ * @return number of bytes consumed; the remaining ones
+ *    (an incomplete line) should be prepended to the next part of text
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static R_len_t stri__read_lines_split(const char* s, R_len_t n, R_len_t from,
+   bool eof, SEXP& ret, R_len_t& nret)
+{
+   const uint8_t* u = (const uint8_t*)s;
+   R_len_t start = 0;
+   R_len_t j = from;
+   while (j < n) {
+      uint8_t c = u[j];
+      R_len_t seplen;
+      if (c > ASCII_CR && c != 0xC2 && c != 0xE2) { ++j; continue; }
+      else if (c == 0) // Rf_mkCharLenCE() would call Rf_error()
+         throw StriException(MSG__EMBEDDED_NUL);
+      else if (c >= ASCII_LF && c <= ASCII_CR) {
+         if (c == ASCII_CR) {
+            if (j+1 >= n && !eof) break; // LF may follow in the next part
+            seplen = (j+1 < n && u[j+1] == ASCII_LF)?2:1;
+         }
+         else
+            seplen = 1;
+      }
+      else if (c == 0xC2 && j+1 < n && u[j+1] == 0x85) // NEL
+         seplen = 2;
+      else if (c == 0xE2 && j+2 < n && u[j+1] == 0x80 && (u[j+2] == 0xA8 || u[j+2] == 0xA9)) // LS, PS
+         seplen = 3;
+      else { ++j; continue; }
+
+      stri__read_lines_push(ret, nret, s+start, j-start);
+      j += seplen;
+      start = j;
+   }
+
+   if (eof) {
+      // the last line does not have to end with a newline
+      if (start < n || nret == 0)
+         stri__read_lines_push(ret, nret, s+start, n-start);
+      return n;
+   }
+   return start;
+}
+
+
+/**
+ * Read a text file, convert it to UTF-8, and split it into lines
+ *
+ * The input is read and converted in chunks, so that the whole file
+ * is never stored in memory (neither in its original encoding nor in UTF-8).
+ *
+ * @param fname single string, file name, or a raw vector with file contents
+ * @param encoding input encoding, \code{NULL} or \code{""} for default
+ * @return character vector
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+SEXP stri_read_lines(SEXP fname, SEXP encoding)
+{
+   const char* selected_enc = stri__prepare_arg_enc(encoding, "encoding", true); /* this is R_alloc'ed */
+   bool from_raw = (TYPEOF(fname) == RAWSXP);
+   if (from_raw)
+      PROTECT(fname);
+   else {
+      PROTECT(fname = stri_prepare_arg_string_1(fname, "fname"));
+      if (STRING_ELT(fname, 0) == NA_STRING)
+         Rf_error(MSG__ARG_EXPECTED_NOT_NA, "fname"); // error() allowed here
+   }
+
+   FILE* f = NULL;
+   STRI__ERROR_HANDLER_BEGIN(1)
+   StriUcnv ucnv_from(selected_enc);
+   StriUcnv ucnv_to("UTF-8");
+   UConverter* uconv_from = ucnv_from.getConverter(true /*register_callbacks*/);
+   UConverter* uconv_to   = ucnv_to.getConverter(true /*register_callbacks*/);
+
+   const char* fname_s = NULL;
+   if (!from_raw) {
+      fname_s = R_ExpandFileName(Rf_translateChar(STRING_ELT(fname, 0)));
+      f = fopen(fname_s, "rb");
+      if (!f) throw StriException(MSG__FILE_OPEN, fname_s);
+   }
+
+   String8buf inbuf(from_raw?0:STRI__FILES_CHUNK_SIZE);
+   String8buf outbuf(STRI__FILES_CHUNK_SIZE*2);
+   R_len_t outn = 0; // number of bytes in outbuf
+
+   SEXP ret;
+   R_len_t nret = 0;
+   STRI__PROTECT(ret = Rf_allocVector(STRSXP, 256));
+
+   UChar pivot[STRI__FILES_PIVOT_SIZE];
+   UChar* pivot_source = pivot;
+   UChar* pivot_target = pivot;
+   UBool reset = TRUE;
+   R_len_t scanned = 0; // no separators in outbuf before this position
+   bool bom_checked = false;
+   bool eof = false;
+   while (!eof) {
+      const char* source;
+      const char* source_limit;
+      if (from_raw) {
+         source = (const char*)RAW(fname);
+         source_limit = source+XLENGTH(fname);
+         eof = true;
+      }
+      else {
+         size_t nread = fread(inbuf.data(), 1, STRI__FILES_CHUNK_SIZE, f);
+         if (ferror(f)) throw StriException(MSG__FILE_READ, fname_s);
+         source = inbuf.data();
+         source_limit = source+nread;
+         eof = (nread < STRI__FILES_CHUNK_SIZE);
+      }
+
+      // convert the chunk, append to the yet-unsplit UTF-8 text
+      while (true) {
+         char* target = outbuf.data()+outn;
+         UErrorCode status = U_ZERO_ERROR;
+         ucnv_convertEx(uconv_to, uconv_from,
+            &target, outbuf.data()+outbuf.size(), &source, source_limit,
+            pivot, &pivot_source, &pivot_target, pivot+STRI__FILES_PIVOT_SIZE,
+            reset, (UBool)eof/*flush*/, &status);
+         outn = (R_len_t)(target-outbuf.data());
+         reset = FALSE;
+         if (status == U_BUFFER_OVERFLOW_ERROR) {
+            if (outbuf.size() >= INT_MAX/2) throw StriException(MSG__MEM_ALLOC_ERROR);
+            outbuf.resize(outbuf.size()*2, true/*retain contents*/);
+            continue;
+         }
+         STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+         break;
+      }
+
+      R_len_t offset = 0;
+      if (!bom_checked && (outn >= 3 || eof)) {
+         // skip the BOM, as StriContainerUTF8 does
+         bom_checked = true;
+         if (outn >= 3 &&
+               (uint8_t)(outbuf.data()[0]) == UTF8_BOM_BYTE1 &&
+               (uint8_t)(outbuf.data()[1]) == UTF8_BOM_BYTE2 &&
+               (uint8_t)(outbuf.data()[2]) == UTF8_BOM_BYTE3)
+            offset = 3;
+      }
+      else if (!bom_checked)
+         continue; // wait for more data
+
+      offset += stri__read_lines_split(outbuf.data()+offset, outn-offset,
+         scanned, eof, ret, nret);
+      memmove(outbuf.data(), outbuf.data()+offset, (size_t)(outn-offset));
+      outn -= offset;
+      // an incomplete line: re-scan only its last 2 bytes
+      // (a CR or the beginning of a multibyte separator)
+      scanned = (outn > 2)?(outn-2):0;
+   }
+
+   if (f) {
+      fclose(f);
+      f = NULL;
+   }
+
+   SEXP ans;
+   STRI__PROTECT(ans = Rf_allocVector(STRSXP, nret));
+   for (R_len_t i=0; i<nret; ++i)
+      SET_STRING_ELT(ans, i, STRING_ELT(ret, i));
+   STRI__UNPROTECT_ALL
+   return ans;
+
+   STRI__ERROR_HANDLER_END({ if (f) fclose(f); })
+}
+
+
+/**
+ * Buffered, re-encoding text writer, see stri_write_lines()
+ *
+ * UTF-8 input is converted chunk by chunk (the converters' state
+ * is retained between calls, so the output is the same as if
+ * the whole text was converted at once) and written to a file
+ * once the output buffer fills up.
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+class StriLineWriter {
+
+   private:
+
+      FILE* m_f;
+      const char* m_fname;
+      StriUcnv m_ucnv_from; // UTF-8
+      StriUcnv m_ucnv_to;
+      UConverter* m_uconv_from;
+      UConverter* m_uconv_to;
+      bool m_to_utf8; // write valid UTF-8 as-is?
+      String8buf m_buf;
+      R_len_t m_bufn; // number of bytes in m_buf
+      UChar m_pivot[STRI__FILES_PIVOT_SIZE];
+      UChar* m_pivot_source;
+      UChar* m_pivot_target;
+      UBool m_reset;
+
+      StriLineWriter(const StriLineWriter&); // no copy
+      StriLineWriter& operator=(const StriLineWriter&); // no copy
+
+
+      /** write the buffer contents to the file */
+      void flushBuffer() {
+         if (m_bufn > 0 && fwrite(m_buf.data(), 1, (size_t)m_bufn, m_f) != (size_t)m_bufn)
+            throw StriException(MSG__FILE_WRITE, m_fname);
+         m_bufn = 0;
+      }
+
+
+   public:
+
+      StriLineWriter(const char* fname, const char* encoding) :
+         m_ucnv_from("UTF-8"), m_ucnv_to(encoding), m_buf(STRI__FILES_CHUNK_SIZE*2)
+      {
+         m_fname = fname;
+         m_bufn = 0;
+         m_pivot_source = m_pivot;
+         m_pivot_target = m_pivot;
+         m_reset = TRUE;
+
+         m_uconv_from = m_ucnv_from.getConverter(true /*register_callbacks*/);
+         m_uconv_to   = m_ucnv_to.getConverter(true /*register_callbacks*/);
+
+         UErrorCode status = U_ZERO_ERROR;
+         const char* name = ucnv_getName(m_uconv_to, &status);
+         STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+         m_to_utf8 = !strcmp(name, "UTF-8");
+
+         m_f = fopen(fname, "wb");
+         if (!m_f) throw StriException(MSG__FILE_OPEN, fname);
+      }
+
+
+      ~StriLineWriter() {
+         if (m_f) fclose(m_f);
+         m_f = NULL;
+      }
+
+
+      /** does the target converter output a BOM on its own? */
+      bool writesBOM() {
+         UErrorCode status = U_ZERO_ERROR;
+         const char* name = ucnv_getName(m_uconv_to, &status);
+         STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+         return !strcmp(name, "UTF-16") || !strcmp(name, "UTF-32");
+      }
+
+
+      /** convert and write a UTF-8 string
+       *
+       * @param s string
+       * @param n number of bytes in s
+       * @param flush is this the last string to be written?
+       */
+      void write(const char* s, R_len_t n, bool flush=false) {
+         // UTF-8 is stateless: the converters may be flushed at
+         // string boundaries, so that valid strings can be copied as-is
+         if (m_to_utf8) flush = true;
+
+         if (m_to_utf8 && stri__utf8_find_invalid(s, n) < 0) {
+            if (m_bufn > m_buf.size()-n-1) {
+               flushBuffer();
+               m_buf.resize(n, true);
+            }
+            memcpy(m_buf.data()+m_bufn, s, (size_t)n);
+            m_bufn += n;
+         }
+         else {
+            const char* source = s;
+            const char* source_limit = s+n;
+            while (true) {
+               char* target = m_buf.data()+m_bufn;
+               UErrorCode status = U_ZERO_ERROR;
+               ucnv_convertEx(m_uconv_to, m_uconv_from,
+                  &target, m_buf.data()+m_buf.size(), &source, source_limit,
+                  m_pivot, &m_pivot_source, &m_pivot_target, m_pivot+STRI__FILES_PIVOT_SIZE,
+                  m_reset, (UBool)flush, &status);
+               m_bufn = (R_len_t)(target-m_buf.data());
+               m_reset = FALSE;
+               if (status == U_BUFFER_OVERFLOW_ERROR) {
+                  flushBuffer(); // and continue where we stopped
+                  continue;
+               }
+               STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+               break;
+            }
+         }
+
+         if (m_bufn >= STRI__FILES_CHUNK_SIZE)
+            flushBuffer();
+      }
+
+
+      /** flush the converters and the buffer, close the file */
+      void close() {
+         write("", 0, true);
+         flushBuffer();
+         FILE* f = m_f;
+         m_f = NULL;
+         if (fclose(f) != 0)
+            throw StriException(MSG__FILE_WRITE, m_fname);
+      }
+};
+
+
+/**
+ * Write text lines to a file
+ *
+ * Each string is converted and written separately, so that
+ * no re-encoded copy of the whole text is ever created.
+ *
+ * @param str character vector
+ * @param fname single string, file name
+ * @param encoding output encoding, \code{NULL} or \code{""} for default
+ * @param sep single string, line separator
+ * @param bom single logical value, should the byte order mark
+ *    be written at the beginning of the file?
+ * @return \code{R_NilValue}
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+SEXP stri_write_lines(SEXP str, SEXP fname, SEXP encoding, SEXP sep, SEXP bom)
+{
+   const char* selected_enc = stri__prepare_arg_enc(encoding, "encoding", true); /* this is R_alloc'ed */
+   bool bom_logical = stri__prepare_arg_logical_1_notNA(bom, "bom");
+   PROTECT(str = stri_prepare_arg_string(str, "str"));
+   PROTECT(fname = stri_prepare_arg_string_1(fname, "fname"));
+   PROTECT(sep = stri_prepare_arg_string_1(sep, "sep"));
+   if (STRING_ELT(fname, 0) == NA_STRING)
+      Rf_error(MSG__ARG_EXPECTED_NOT_NA, "fname"); // error() allowed here
+   if (STRING_ELT(sep, 0) == NA_STRING)
+      Rf_error(MSG__ARG_EXPECTED_NOT_NA, "sep"); // error() allowed here
+
+   STRI__ERROR_HANDLER_BEGIN(3)
+   R_len_t str_n = LENGTH(str);
+   StriContainerUTF8 str_cont(str, str_n);
+   StriContainerUTF8 sep_cont(sep, 1);
+   const char* sep_s = sep_cont.get(0).c_str();
+   R_len_t sep_n = sep_cont.get(0).length();
+
+   const char* fname_s = R_ExpandFileName(Rf_translateChar(STRING_ELT(fname, 0)));
+   StriLineWriter writer(fname_s, selected_enc);
+
+   if (bom_logical && !writer.writesBOM()) {
+      // U+FEFF, converted to the target encoding
+      const char bom_utf8[] = { (char)UTF8_BOM_BYTE1, (char)UTF8_BOM_BYTE2, (char)UTF8_BOM_BYTE3 };
+      writer.write(bom_utf8, 3);
+   }
+
+   for (R_len_t i=0; i<str_n; ++i) {
+      if (str_cont.isNA(i))
+         writer.write("NA", 2); // as in writeLines()
+      else
+         writer.write(str_cont.get(i).c_str(), str_cont.get(i).length());
+      writer.write(sep_s, sep_n);
+   }
+
+   writer.close();
+
+   STRI__UNPROTECT_ALL
+   return R_NilValue;
+
+   STRI__ERROR_HANDLER_END({/* writer closes the file */})
+}
@@ -32,6 +32,7 @@
 #include "stri_stringi.h"
 #include "stri_ucnv.h"
 #include "stri_container_utf8.h"
+#include <vector>
 
 
 /**
@@ -86,6 +87,9 @@ R_len_t stri__numbytes_max(SEXP str)
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    UTF-8: stri__utf8_count_valid()
  */
 SEXP stri_length(SEXP str)
 {
@@ -115,16 +119,8 @@ SEXP stri_length(SEXP str)
          throw StriException(MSG__BYTESENC);
       }
       else if (IS_UTF8(curs) || ucnvNative.isUTF8()) { // utf8 or native-utf8
-         UChar32 c = 0;
-         const char* curs_s = CHAR(curs);
-         R_len_t j = 0;
-         R_len_t i = 0;
-         while (c >= 0 && j < curs_n) {
-            U8_NEXT(curs_s, j, curs_n, c); // faster that U8_FWD_1 & gives bad UChar32s
-            i++;
-         }
-
-         if (c < 0) { // invalid utf-8 sequence
+         R_len_t i = stri__utf8_count_valid(CHAR(curs), curs_n);
+         if (i < 0) { // invalid utf-8 sequence
             Rf_warning(MSG__INVALID_UTF8);
             retint[k] = NA_INTEGER;
          }
@@ -231,14 +227,17 @@ SEXP stri_isempty(SEXP str)
 }
 
 
-/** Get width of a single character
+/** Get width of a single character, as computed by ICU
  *
  * inspired by http://www.cl.cam.ac.uk/~mgk25/ucs/wcwidth.c
  *
  * @param c code point
  * @return 0, 1, or 2
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    renamed from stri__width_char, see stri__width_char()
  */
-int stri__width_char(UChar32 c) {
+static int stri__width_char_icu(UChar32 c) {
    if (c == (UChar32)0x00AD) return 1; /* SOFT HYPHEN  */
    if (c == (UChar32)0x200B) return 0; /* ZERO WIDTH SPACE */
 
@@ -263,11 +262,78 @@ int stri__width_char(UChar32 c) {
 }
 
 
+#define STRI__WIDTH_BLOCK_SHIFT 8
+#define STRI__WIDTH_BLOCK_SIZE  (1<<STRI__WIDTH_BLOCK_SHIFT)
+#define STRI__WIDTH_NBLOCKS     ((UCHAR_MAX_VALUE>>STRI__WIDTH_BLOCK_SHIFT)+1)
+
+/** two-stage width lookup table:
+ * stri__width_stage1[c>>8] == k > 0 iff the widths of the code points
+ * in the block of c are stored at stri__width_stage2[(k-1)*256+0..255];
+ * 0 denotes a block that has not been used yet.
+ * Identical blocks (e.g., unassigned code points or CJK ideographs)
+ * are stored only once.
+ */
+static uint16_t stri__width_stage1[STRI__WIDTH_NBLOCKS];
+static std::vector<uint8_t> stri__width_stage2;
+
+
+/** Fill a block of the two-stage width table
+ *
+ * @param block c>>8 for some code point c
+ * @return the block's index in stri__width_stage2, plus 1
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static uint16_t stri__width_prepare_block(UChar32 block) {
+   uint8_t widths[STRI__WIDTH_BLOCK_SIZE];
+   UChar32 c = block<<STRI__WIDTH_BLOCK_SHIFT;
+   for (int k=0; k<STRI__WIDTH_BLOCK_SIZE; ++k)
+      widths[k] = (uint8_t)stri__width_char_icu(c+k);
+
+   size_t nblocks = stri__width_stage2.size()/STRI__WIDTH_BLOCK_SIZE;
+   for (size_t k=0; k<nblocks; ++k) {
+      if (!memcmp(widths, &stri__width_stage2[k*STRI__WIDTH_BLOCK_SIZE], STRI__WIDTH_BLOCK_SIZE))
+         return (stri__width_stage1[block] = (uint16_t)(k+1));
+   }
+
+   stri__width_stage2.insert(stri__width_stage2.end(), widths, widths+STRI__WIDTH_BLOCK_SIZE);
+   return (stri__width_stage1[block] = (uint16_t)(nblocks+1));
+}
+
+
+/** Get width of a single character
+ *
+ * The widths are determined by ICU (see stri__width_char_icu())
+ * and memoized in a two-stage lookup table, one block of
+ * 256 code points at a time.
+ *
+ * @param c code point
+ * @return 0, 1, or 2
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    ASCII fast path and a two-stage lookup table
+ */
+int stri__width_char(UChar32 c) {
+   if (c < 0x80 && c >= 0) /* ASCII: Cc -> 0, other -> 1 */
+      return (c < 0x20 || c == 0x7F) ? 0 : 1;
+
+   if (c < 0 || c > UCHAR_MAX_VALUE)
+      return stri__width_char_icu(c);
+
+   uint16_t k = stri__width_stage1[c>>STRI__WIDTH_BLOCK_SHIFT];
+   if (!k) k = stri__width_prepare_block(c>>STRI__WIDTH_BLOCK_SHIFT);
+   return (int)stri__width_stage2[(k-1)*STRI__WIDTH_BLOCK_SIZE+(c&(STRI__WIDTH_BLOCK_SIZE-1))];
+}
+
+
 /** Get width of a single UTF-8 string
  *
  * @param str_cur_s string
  * @param str_cur_n number of bytes in str_cur_s
  * @return width
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    ASCII fast path
  */
 int stri__width_string(const char* str_cur_s, int str_cur_n) {
    int cur_width = 0;
@@ -275,6 +341,13 @@ int stri__width_string(const char* str_cur_s, int str_cur_n) {
    UChar32 c;
    R_len_t j = 0;
    while (j < str_cur_n) {
+      if (U8_IS_SINGLE(str_cur_s[j])) {
+         /* ASCII: Cc -> 0, other -> 1 */
+         c = (UChar32)str_cur_s[j++];
+         cur_width += (c < 0x20 || c == 0x7F) ? 0 : 1;
+         continue;
+      }
+
       U8_NEXT(str_cur_s, j, str_cur_n, c);
       if (c < 0)
          throw StriException(MSG__INVALID_UTF8);
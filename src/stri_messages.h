@@ -49,6 +49,9 @@
 #define MSG__INCORRECT_BRKITER_OPTION_SPEC \
    "incorrect break iterator option specifier. see ?stri_opts_brkiter"
 
+#define MSG__INCORRECT_BRKITER_BINARY \
+   "incorrect or corrupted precompiled break iterator rules. see ?stri_brkiter_compile"
+
 #define MSG__INCORRECT_FIXED_OPTION \
    "incorrect opts_fixed setting: `%s`. ignoring"
 
@@ -280,4 +283,16 @@
 #define MSG__MEM_ALLOC_ERROR \
    "memory allocation error"
 
+#define MSG__FILE_OPEN \
+   "cannot open file `%s`"
+
+#define MSG__FILE_READ \
+   "error reading file `%s`"
+
+#define MSG__EMBEDDED_NUL \
+   "embedded nul in string; is the encoding correct?"
+
+#define MSG__FILE_WRITE \
+   "error writing file `%s`"
+
 #endif
@@ -58,6 +58,9 @@
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    ASCII fast path: getMatcherASCII()
  */
 SEXP stri_count_coll(SEXP str, SEXP pattern, SEXP opts_collator)
 {
@@ -86,6 +89,15 @@ SEXP stri_count_coll(SEXP str, SEXP pattern, SEXP opts_collator)
          ret_tab[i] = NA_INTEGER,
          ret_tab[i] = 0)
 
+      StriByteSearchMatcher* asciimatcher = pattern_cont.getMatcherASCII(i, str_cont.get(i));
+      if (asciimatcher) {
+         R_len_t found = 0;
+         while ((int)asciimatcher->findNext() != USEARCH_DONE)
+            ++found;
+         ret_tab[i] = found;
+         continue;
+      }
+
       UStringSearch *matcher = pattern_cont.getMatcher(i, str_cont.get(i));
       usearch_reset(matcher);
       UErrorCode status = U_ZERO_ERROR;
@@ -61,6 +61,9 @@
  *
  * @version 1.0-3 (Marek Gagolewski, 2016-02-03)
  *    FR #216: `negate` arg added
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    ASCII fast path: getMatcherASCII()
  */
 SEXP stri_detect_coll(SEXP str, SEXP pattern, SEXP negate, SEXP opts_collator)
 {
@@ -90,6 +93,13 @@ SEXP stri_detect_coll(SEXP str, SEXP pattern, SEXP negate, SEXP opts_collator)
          ret_tab[i] = NA_LOGICAL,
          ret_tab[i] = negate_1)
 
+      StriByteSearchMatcher* asciimatcher = pattern_cont.getMatcherASCII(i, str_cont.get(i));
+      if (asciimatcher) {
+         ret_tab[i] = ((int)asciimatcher->findFirst() != USEARCH_DONE);
+         if (negate_1) ret_tab[i] = !ret_tab[i];
+         continue;
+      }
+
       UStringSearch *matcher = pattern_cont.getMatcher(i, str_cont.get(i));
       usearch_reset(matcher);
       UErrorCode status = U_ZERO_ERROR;
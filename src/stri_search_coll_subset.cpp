@@ -61,6 +61,9 @@
  *
  * @version 1.0-3 (Marek Gagolewski, 2016-02-03)
  *    FR #216: `negate` arg added
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    ASCII fast path: getMatcherASCII()
  */
 SEXP stri_subset_coll(SEXP str, SEXP pattern, SEXP omit_na, SEXP negate, SEXP opts_collator)
 {
@@ -93,6 +96,14 @@ SEXP stri_subset_coll(SEXP str, SEXP pattern, SEXP omit_na, SEXP negate, SEXP op
          {if (omit_na1) which[i] = FALSE; else {which[i] = NA_LOGICAL; result_counter++;} },
          {which[i] = negate_1; if (which[i]) result_counter++;})
 
+      StriByteSearchMatcher* asciimatcher = pattern_cont.getMatcherASCII(i, str_cont.get(i));
+      if (asciimatcher) {
+         which[i] = ((int)asciimatcher->findFirst() != USEARCH_DONE);
+         if (negate_1) which[i] = !which[i];
+         if (which[i]) result_counter++;
+         continue;
+      }
+
       UStringSearch *matcher = pattern_cont.getMatcher(i, str_cont.get(i));
       usearch_reset(matcher);
       UErrorCode status = U_ZERO_ERROR;
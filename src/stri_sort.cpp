@@ -70,6 +70,247 @@ struct StriSortComparer {
 };
 
 
+/** A hash set of element indices, codepoint-wise equality [internal]
+ *
+ * R caches CHARSXPs, so identical pointers always denote equal strings.
+ * If all the elements are in ASCII or BOM-less UTF-8, the converse is also
+ * true: we just hash the pointers. Otherwise, the strings that are not
+ * pointer-identical to any already seen one are also hashed bytewise,
+ * in UTF-8.
+ *
+ * Its insert() method mimics std::set::insert(i).second.
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+class StriCodepointSet {
+
+   private:
+
+      SEXP str;                    ///< character vector
+      StriContainerUTF8* str_cont; ///< NULL if pointer hashing suffices
+      std::vector<R_len_t> ptr_tab;  ///< open addressing, -1 == empty slot
+      std::vector<R_len_t> byte_tab; ///< as above, used if str_cont != NULL
+      size_t mask;                 ///< table size - 1 (power of 2)
+
+      static size_t hashPtr(SEXP s) {
+         size_t h = (size_t)s;
+         h ^= (h >> 4);
+         return h*(size_t)2654435761U;
+      }
+
+      static size_t hashBytes(const char* s, R_len_t n) {
+         size_t h = (size_t)2166136261U; // FNV-1a
+         for (R_len_t j=0; j<n; ++j)
+            h = (h ^ (size_t)(uint8_t)s[j])*(size_t)16777619U;
+         return h;
+      }
+
+   public:
+
+      /** Constructor
+       *
+       * @param _str a prepared character vector
+       * @param _str_cont a UTF-8 container for \code{_str},
+       *    used only if \code{needsContents(_str)} is true
+       */
+      StriCodepointSet(SEXP _str, StriContainerUTF8* _str_cont)
+      {
+         str = _str;
+         str_cont = _str_cont;
+         R_len_t n = LENGTH(str);
+         size_t size = 16;
+         while (size < 2*(size_t)n) size *= 2;
+         mask = size-1;
+         ptr_tab.resize(size, -1);
+         if (str_cont) byte_tab.resize(size, -1);
+      }
+
+
+      /** Do pointer comparisons not suffice for \code{str}?
+       *
+       * @param str a prepared character vector
+       * @return true if there is a non-NA string
+       *    that is not in ASCII or BOM-less UTF-8
+       */
+      static bool needsContents(SEXP str)
+      {
+         R_len_t n = LENGTH(str);
+         for (R_len_t i=0; i<n; ++i) {
+            SEXP curs = STRING_ELT(str, i);
+            if (curs == NA_STRING || IS_ASCII(curs))
+               continue;
+            if (!IS_UTF8(curs))
+               return true; // latin1, native, or bytes
+            const char* s = CHAR(curs);
+            if (STRI__ENC_HAS_BOM_UTF8(s, LENGTH(curs)))
+               return true; // BOMs are ignored by StriContainerUTF8
+         }
+         return false;
+      }
+
+
+      /** Add the i-th element (must not be NA) to the set
+       *
+       * @param i index
+       * @return true if no equal string has been inserted so far
+       */
+      bool insert(R_len_t i)
+      {
+         SEXP curs = STRING_ELT(str, i);
+         size_t k = hashPtr(curs) & mask;
+         while (ptr_tab[k] >= 0) {
+            if (STRING_ELT(str, ptr_tab[k]) == curs)
+               return false;
+            k = (k+1) & mask;
+         }
+         ptr_tab[k] = i;
+
+         if (!str_cont)
+            return true;
+
+         const String8* cur8 = &str_cont->get(i);
+         k = hashBytes(cur8->c_str(), cur8->length()) & mask;
+         while (byte_tab[k] >= 0) {
+            const String8* old8 = &str_cont->get(byte_tab[k]);
+            if (old8->length() == cur8->length() &&
+                  memcmp(old8->c_str(), cur8->c_str(), (size_t)cur8->length()) == 0)
+               return false;
+            k = (k+1) & mask;
+         }
+         byte_tab[k] = i;
+         return true;
+      }
+};
+
+
+/** Does the user want codepoint-wise comparison? [internal]
+ *
+ * @param opts_collator as passed to stri_unique() and the like
+ * @return true if opts_collator is a single NA
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+bool stri__is_opts_collator_codepoints(SEXP opts_collator)
+{
+   return (Rf_isVectorAtomic(opts_collator) && LENGTH(opts_collator) == 1 &&
+      TYPEOF(opts_collator) == LGLSXP && LOGICAL(opts_collator)[0] == NA_LOGICAL);
+}
+
+
+/** Get unique elements from a character vector, no collation [internal]
+ *
+ * @param str character vector
+ * @return character vector
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+SEXP stri__unique_codepoints(SEXP str)
+{
+   PROTECT(str = stri_prepare_arg_string(str, "str")); // prepare string argument
+
+   StriContainerUTF8* str_cont = NULL;
+   STRI__ERROR_HANDLER_BEGIN(1)
+
+   R_len_t vectorize_length = LENGTH(str);
+   if (StriCodepointSet::needsContents(str))
+      str_cont = new StriContainerUTF8(str, vectorize_length);
+   StriCodepointSet uniqueset(str, str_cont);
+
+   bool was_na = false;
+   deque<SEXP> temp;
+   for (R_len_t i=0; i<vectorize_length; ++i) {
+      if (STRING_ELT(str, i) == NA_STRING) {
+         if (!was_na) {
+            was_na = true;
+            temp.push_back(NA_STRING);
+         }
+      }
+      else if (uniqueset.insert(i)) {
+         temp.push_back(str_cont?str_cont->toR(i):STRING_ELT(str, i));
+      }
+   }
+
+   SEXP ret;
+   STRI__PROTECT(ret = Rf_allocVector(STRSXP, temp.size()));
+   R_len_t i = 0;
+   for (deque<SEXP>::iterator it = temp.begin(); it != temp.end(); it++) {
+      SET_STRING_ELT(ret, i++, *it);
+   }
+
+   if (str_cont) {
+      delete str_cont;
+      str_cont = NULL;
+   }
+
+   STRI__UNPROTECT_ALL
+   return ret;
+
+   STRI__ERROR_HANDLER_END({
+      if (str_cont) { delete str_cont; str_cont = NULL; }
+   })
+}
+
+
+/** Determine duplicated elements, no collation [internal]
+ *
+ * @param str character vector
+ * @param fromLast logical value
+ * @param _any [internal] false for stri_duplicated, true for stri_duplicated_any
+ * @return logical vector or a single integer
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+SEXP stri__duplicated_codepoints(SEXP str, SEXP fromLast, bool _any)
+{
+   PROTECT(str = stri_prepare_arg_string(str, "str")); // prepare string argument
+   bool fromLastBool = stri__prepare_arg_logical_1_notNA(fromLast, "fromLast");
+
+   StriContainerUTF8* str_cont = NULL;
+   STRI__ERROR_HANDLER_BEGIN(1)
+
+   R_len_t vectorize_length = LENGTH(str);
+   if (StriCodepointSet::needsContents(str))
+      str_cont = new StriContainerUTF8(str, vectorize_length);
+   StriCodepointSet uniqueset(str, str_cont);
+
+   bool was_na = false;
+   SEXP ret;
+   STRI__PROTECT(ret = Rf_allocVector(_any?INTSXP:LGLSXP, _any?1:vectorize_length));
+   int* ret_tab = _any?INTEGER(ret):LOGICAL(ret);
+   if (_any) ret_tab[0] = 0;
+
+   for (R_len_t j=0; j<vectorize_length; ++j) {
+      R_len_t i = (fromLastBool)?(vectorize_length-1-j):j;
+      bool dup;
+      if (STRING_ELT(str, i) == NA_STRING) {
+         dup = was_na;
+         was_na = true;
+      }
+      else
+         dup = !uniqueset.insert(i);
+
+      if (!_any)
+         ret_tab[i] = dup;
+      else if (dup) {
+         ret_tab[0] = i+1;
+         break;
+      }
+   }
+
+   if (str_cont) {
+      delete str_cont;
+      str_cont = NULL;
+   }
+
+   STRI__UNPROTECT_ALL
+   return ret;
+
+   STRI__ERROR_HANDLER_END({
+      if (str_cont) { delete str_cont; str_cont = NULL; }
+   })
+}
+
+
 /** Generate the ordering permutation, possibly with collation [internal]
  *
  * @param str character vector
@@ -253,9 +494,15 @@ SEXP stri_sort(SEXP str, SEXP decreasing, SEXP na_last, SEXP opts_collator)
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    opts_collator == NA for codepoint-wise comparison
  */
 SEXP stri_unique(SEXP str, SEXP opts_collator)
 {
+   if (stri__is_opts_collator_codepoints(opts_collator))
+      return stri__unique_codepoints(str);
+
    PROTECT(str = stri_prepare_arg_string(str, "str")); // prepare string argument
 
    // call stri__ucol_open after prepare_arg:
@@ -323,9 +570,15 @@ SEXP stri_unique(SEXP str, SEXP opts_collator)
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    opts_collator == NA for codepoint-wise comparison
  */
 SEXP stri_duplicated(SEXP str, SEXP fromLast, SEXP opts_collator)
 {
+   if (stri__is_opts_collator_codepoints(opts_collator))
+      return stri__duplicated_codepoints(str, fromLast, false);
+
    PROTECT(str = stri_prepare_arg_string(str, "str")); // prepare string argument
    bool fromLastBool = stri__prepare_arg_logical_1_notNA(fromLast, "fromLast");
 
@@ -403,9 +656,15 @@ SEXP stri_duplicated(SEXP str, SEXP fromLast, SEXP opts_collator)
  *
  * @version 0.3-1 (Marek Gagolewski, 2014-11-04)
  *    Issue #112: str_prepare_arg* retvals were not PROTECTed from gc
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    opts_collator == NA for codepoint-wise comparison
  */
 SEXP stri_duplicated_any(SEXP str, SEXP fromLast, SEXP opts_collator)
 {
+   if (stri__is_opts_collator_codepoints(opts_collator))
+      return stri__duplicated_codepoints(str, fromLast, true);
+
    PROTECT(str = stri_prepare_arg_string(str, "str")); // prepare string argument
    bool fromLastBool = stri__prepare_arg_logical_1_notNA(fromLast, "fromLast");
 
@@ -63,6 +63,9 @@
  *
  * @version 0.5-1 (Marek Gagolewski, 2015-02-14)
  *          new field: m_isASCII
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *          countCodePoints() uses stri__utf8_count_valid()
  */
 class String8  {
 
@@ -262,6 +265,11 @@ class String8  {
          if (m_isASCII)
             return m_n;
 
+         R_len_t count = stri__utf8_count_valid(m_str, m_n);
+         if (count >= 0)
+            return count;
+
+         // invalid UTF-8: count each ill-formed sequence as one code point
          UChar32 c = 0;
          R_len_t j = 0;
          R_len_t i = 0;
@@ -56,6 +56,7 @@ const R_CallMethodDef cCallMethods[] = {
 //   STRI__MK_CALL("C_stri_charcategories",             stri_charcategories,             0),  // TO BE >= 0.6
 //   STRI__MK_CALL("C_stri_chartype",                   stri_chartype,                   1),  // TO BE >= 0.6
 // STRI__MK_CALL("C_stri_c_posixst",                    stri_c_posixst,                  1),  // internal
+   STRI__MK_CALL("C_stri_brkiter_compile",              stri_brkiter_compile,            1),
    STRI__MK_CALL("C_stri_cmp_eq",                       stri_cmp_eq,                     2),
    STRI__MK_CALL("C_stri_cmp_neq",                      stri_cmp_neq,                    2),
    STRI__MK_CALL("C_stri_cmp",                          stri_cmp,                        3),
@@ -168,6 +169,7 @@ const R_CallMethodDef cCallMethods[] = {
    STRI__MK_CALL("C_stri_prepare_arg_logical_1",        stri_prepare_arg_logical_1,      2),
    STRI__MK_CALL("C_stri_rand_shuffle",                 stri_rand_shuffle,               1),
    STRI__MK_CALL("C_stri_rand_strings",                 stri_rand_strings,               3),
+   STRI__MK_CALL("C_stri_read_lines",                   stri_read_lines,                 2),
    STRI__MK_CALL("C_stri_replace_na",                   stri_replace_na,                 2),
    STRI__MK_CALL("C_stri_replace_all_fixed",            stri_replace_all_fixed,          5),
    STRI__MK_CALL("C_stri_replace_first_fixed",          stri_replace_first_fixed,        4),
@@ -218,7 +220,8 @@ const R_CallMethodDef cCallMethods[] = {
    STRI__MK_CALL("C_stri_trans_isnfkc",                 stri_trans_isnfkc,               1),
    STRI__MK_CALL("C_stri_trans_isnfkd",                 stri_trans_isnfkd,               1),
    STRI__MK_CALL("C_stri_trans_isnfkc_casefold",        stri_trans_isnfkc_casefold,      1),
-   STRI__MK_CALL("C_stri_trans_general",                stri_trans_general,              2),
+   STRI__MK_CALL("C_stri_trans_general",                stri_trans_general,              3),
+   STRI__MK_CALL("C_stri_trans_general_rules",          stri_trans_general_rules,        4),
    STRI__MK_CALL("C_stri_trans_list",                   stri_trans_list,                 0),
    STRI__MK_CALL("C_stri_trans_nfc",                    stri_trans_nfc,                  1),
    STRI__MK_CALL("C_stri_trans_nfd",                    stri_trans_nfd,                  1),
@@ -235,6 +238,7 @@ const R_CallMethodDef cCallMethods[] = {
    STRI__MK_CALL("C_stri_unique",                       stri_unique,                     2),
    STRI__MK_CALL("C_stri_width",                        stri_width,                      1),
    STRI__MK_CALL("C_stri_wrap",                         stri_wrap,                      10),
+   STRI__MK_CALL("C_stri_write_lines",                  stri_write_lines,                5),
 //   STRI__MK_CALL("C_stri_trim_double",                stri_trim_double,                3), // TODO: version >= 0.6
 
    // the list must be NULL-terminated:
@@ -350,6 +354,12 @@ extern "C" void  R_unload_stringi(DllInfo*)
 //   fprintf(stdout, "!NDEBUG: ************************************************\n");
 //   fprintf(stdout, "!NDEBUG: Dynamic library 'stringi' unloaded.\n");
 //   fprintf(stdout, "!NDEBUG: ************************************************\n");
+   stri__ucol_cache_cleanup();
+   stri__brkiter_cache_cleanup();
+   stri__ucnv_pool_cleanup();
+   stri__trans_cache_cleanup();
+   stri__calendar_cache_cleanup();
+   stri__datefmt_cache_cleanup();
    u_cleanup();
 }
 
@@ -37,6 +37,7 @@
 #include "stri_messages.h"
 #include "stri_macros.h"
 #include "stri_exception.h"
+#include "stri_utf8.h"
 #include "stri_string8.h"
 #include "stri_container_utf8.h"
 #include "stri_container_utf16.h"
@@ -59,6 +60,10 @@ int     stri__match_arg(const char* option, const char** set);
 // collator.cpp:
 struct UCollator;
 UCollator* stri__ucol_open(SEXP opts_collator);
+void stri__ucol_cache_cleanup();
+void stri__brkiter_cache_cleanup();
+void stri__ucnv_pool_cleanup();
+void stri__trans_cache_cleanup();
 
 // length.cpp
 R_len_t stri__numbytes_max(SEXP str);
@@ -108,6 +113,12 @@ SEXP stri__subset_by_logical(const StriContainerUTF16& str_cont,
 
 // date/time
 void stri__set_class_POSIXct(SEXP x);
+Calendar* stri__calendar_create(const char* locale, const TimeZone& tz, bool lenient);
+void stri__calendar_cache_cleanup();
+void stri__datefmt_cache_cleanup();
+int stri__days_from_civil(int y, int m, int d);
+void stri__civil_from_days(int z, int& y, int& m, int& d);
+bool stri__timezone_fixed_offset(const TimeZone& tz, int32_t& offset);
 
 // encoding_conversion.cpp:
 SEXP stri_encode_from_marked(SEXP str, SEXP to, SEXP to_raw);
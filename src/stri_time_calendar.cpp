@@ -34,8 +34,91 @@
 #include "stri_container_utf8.h"
 #include "stri_container_double.h"
 #include "stri_container_integer.h"
+#include "stri_time_zone.h"
 #include <unicode/calendar.h>
 #include <unicode/gregocal.h>
+#include <string>
+#include <cstring>
+#include <cmath>
+
+
+#define STRI__CALENDAR_CACHE_SIZE 4
+
+
+/** A prototype Calendar with the settings it has been created with
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+struct StriCalendarCacheEntry {
+   std::string locale;
+   bool lenient;
+   Calendar* proto; ///< NULL if the slot is free; owns a copy of the TimeZone
+};
+
+static StriCalendarCacheEntry stri__calendar_cache[STRI__CALENDAR_CACHE_SIZE];
+static int stri__calendar_cache_next = 0; ///< slot to be overwritten next
+
+
+/** Delete all the cached Calendars, see stri__calendar_create()
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+void stri__calendar_cache_cleanup()
+{
+   for (int k=0; k<STRI__CALENDAR_CACHE_SIZE; ++k) {
+      if (stri__calendar_cache[k].proto) {
+         delete stri__calendar_cache[k].proto;
+         stri__calendar_cache[k].proto = NULL;
+      }
+   }
+}
+
+
+/** Create a new Calendar
+ *
+ * Loading locale and time zone data is costly, therefore
+ * prototypes for the most recently used settings are cached
+ * and the caller gets their clones.
+ *
+ * @param locale locale ID
+ * @param tz time zone, a copy is made if needed
+ * @param lenient lenient mode
+ * @return a new object, to be deleted by the caller
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+Calendar* stri__calendar_create(const char* locale, const TimeZone& tz, bool lenient)
+{
+   StriCalendarCacheEntry* entry = NULL;
+   for (int k=0; k<STRI__CALENDAR_CACHE_SIZE; ++k) {
+      StriCalendarCacheEntry* cur = &stri__calendar_cache[k];
+      if (cur->proto && cur->lenient == lenient && cur->locale == locale
+            && cur->proto->getTimeZone() == tz) {
+         entry = cur;
+         break;
+      }
+   }
+
+   if (!entry) {
+      UErrorCode status = U_ZERO_ERROR;
+      Calendar* proto = Calendar::createInstance(locale, status);
+      STRI__CHECKICUSTATUS_THROW(status, { if (proto) delete proto; })
+      if (!proto) throw StriException(MSG__MEM_ALLOC_ERROR);
+      proto->setLenient(lenient);
+      proto->adoptTimeZone(tz.clone());
+
+      entry = &stri__calendar_cache[stri__calendar_cache_next];
+      stri__calendar_cache_next = (stri__calendar_cache_next+1)%STRI__CALENDAR_CACHE_SIZE;
+      if (entry->proto) delete entry->proto;
+      entry->proto   = proto;
+      entry->locale  = locale;
+      entry->lenient = lenient;
+   }
+
+   Calendar* cal = entry->proto->clone();
+   if (!cal) throw StriException(MSG__MEM_ALLOC_ERROR);
+   return cal;
+}
 
 
 /** Set POSIXct class on a given object
@@ -55,6 +138,54 @@ void stri__set_class_POSIXct(SEXP x) {
 }
 
 
+/** Get the number of days since 1970-01-01 of a date
+ * in the proleptic Gregorian calendar
+ *
+ * See H. Hinnant, chrono-Compatible Low-Level Date Algorithms,
+ * http://howardhinnant.github.io/date_algorithms.html
+ *
+ * @param y year
+ * @param m month, 1-12
+ * @param d day, 1-31
+ * @return days since the epoch
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+int stri__days_from_civil(int y, int m, int d)
+{
+   y -= (m <= 2);
+   int era = ((y >= 0) ? y : y-399)/400;
+   int yoe = y - era*400;                                  // [0, 399]
+   int doy = (153*(m + ((m > 2) ? -3 : 9)) + 2)/5 + d-1;   // [0, 365]
+   int doe = yoe*365 + yoe/4 - yoe/100 + doy;              // [0, 146096]
+   return era*146097 + doe - 719468;
+}
+
+
+/** Get the proleptic Gregorian calendar date from the number of days
+ * since 1970-01-01, see stri__days_from_civil()
+ *
+ * @param z days since the epoch
+ * @param y [out] year
+ * @param m [out] month, 1-12
+ * @param d [out] day, 1-31
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+void stri__civil_from_days(int z, int& y, int& m, int& d)
+{
+   z += 719468;
+   int era = ((z >= 0) ? z : z-146096)/146097;
+   int doe = z - era*146097;                                  // [0, 146096]
+   int yoe = (doe - doe/1460 + doe/36524 - doe/146096)/365;   // [0, 399]
+   int doy = doe - (365*yoe + yoe/4 - yoe/100);               // [0, 365]
+   int mp  = (5*doy + 2)/153;                                 // [0, 11]
+   d = doy - (153*mp + 2)/5 + 1;
+   m = mp + ((mp < 10) ? 3 : -9);
+   y = yoe + era*400 + (m <= 2);
+}
+
+
 /** Get current date-time
  *
  * @return POSIXct
@@ -84,6 +215,8 @@ SEXP stri_datetime_now()
  *
  * @version 0.5-1 (Marek Gagolewski, 2014-12-30)
  * @version 0.5-1 (Marek Gagolewski, 2015-03-06) tz arg added
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    use stri__calendar_create; arithmetic path for fixed-length units
  */
 SEXP stri_datetime_add(SEXP time, SEXP value, SEXP units, SEXP tz, SEXP locale) {
    PROTECT(time = stri_prepare_arg_POSIXct(time, "time"));
@@ -106,25 +239,42 @@ SEXP stri_datetime_add(SEXP time, SEXP value, SEXP units, SEXP tz, SEXP locale)
    StriContainerDouble time_cont(time, vectorize_length);
    StriContainerInteger value_cont(value, vectorize_length);
 
+   // Calendar::add() just adds a multiple of unit_ms for fixed-length units;
+   // for days and weeks, this holds only if the UTC offset does not change
    UCalendarDateFields units_field;
+   double unit_ms = 0.0;   // 0 - not a fixed-length unit
+   bool wall_time = false; // is the wall time kept invariant?
    switch (units_cur) {
-      case 0: units_field = UCAL_YEAR;                   break;
-      case 1: units_field = UCAL_MONTH;                  break;
-      case 2: units_field = UCAL_WEEK_OF_YEAR;           break;
-      case 3: units_field = UCAL_DAY_OF_MONTH;           break;
-      case 4: units_field = UCAL_HOUR_OF_DAY;            break;
-      case 5: units_field = UCAL_MINUTE;                 break;
-      case 6: units_field = UCAL_SECOND;                 break;
-      case 7: units_field = UCAL_MILLISECOND;            break;
+      case 0: units_field = UCAL_YEAR;                                                   break;
+      case 1: units_field = UCAL_MONTH;                                                  break;
+      case 2: units_field = UCAL_WEEK_OF_YEAR; unit_ms = 604800000.0; wall_time = true;  break;
+      case 3: units_field = UCAL_DAY_OF_MONTH; unit_ms = 86400000.0;  wall_time = true;  break;
+      case 4: units_field = UCAL_HOUR_OF_DAY;  unit_ms = 3600000.0;                      break;
+      case 5: units_field = UCAL_MINUTE;       unit_ms = 60000.0;                        break;
+      case 6: units_field = UCAL_SECOND;       unit_ms = 1000.0;                         break;
+      case 7: units_field = UCAL_MILLISECOND;  unit_ms = 1.0;                            break;
       default: throw StriException(MSG__INCORRECT_MATCH_OPTION, "units");
    }
 
+   cal = stri__calendar_create(locale_val, *tz_val, true);
+
    UErrorCode status = U_ZERO_ERROR;
-   cal = Calendar::createInstance(locale_val, status);
-   STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
 
-   cal->adoptTimeZone(tz_val);
-   tz_val = NULL; /* The Calendar takes ownership of the TimeZone. */
+   int32_t fixed_offset;
+   bool fixed = stri__timezone_fixed_offset(cal->getTimeZone(), fixed_offset);
+   double time_from = 0.0, time_to = -1.0; // no transitions needed
+   if (wall_time && !fixed)
+      stri__time_range_ms(time, time_from, time_to);
+   if (time_from <= time_to) { // the results are covered as well
+      double max_delta = 0.0;
+      for (R_len_t i=0; i<LENGTH(value); ++i) {
+         if (INTEGER(value)[i] != NA_INTEGER && fabs((double)INTEGER(value)[i]) > max_delta)
+            max_delta = fabs((double)INTEGER(value)[i]);
+      }
+      time_from -= max_delta*unit_ms;
+      time_to   += max_delta*unit_ms;
+   }
+   StriTimeZoneOffsets tz_offsets(cal->getTimeZone(), time_from, time_to);
 
    SEXP ret;
    STRI__PROTECT(ret = Rf_allocVector(REALSXP, vectorize_length));
@@ -134,8 +284,19 @@ SEXP stri_datetime_add(SEXP time, SEXP value, SEXP units, SEXP tz, SEXP locale)
          ret_val[i] = NA_REAL;
          continue;
       }
+
+      UDate t = (UDate)(time_cont.get(i)*1000.0);
+      if (unit_ms > 0.0) {
+         UDate t_new = t + (double)value_cont.get(i)*unit_ms;
+         if (fabs(t) < STRI__TIME_MAX_MILLIS && fabs(t_new) < STRI__TIME_MAX_MILLIS &&
+               (!wall_time || fixed || tz_offsets.getOffset(t) == tz_offsets.getOffset(t_new))) {
+            ret_val[i] = ((double)t_new)/1000.0;
+            continue;
+         }
+      }
+
       status = U_ZERO_ERROR;
-      cal->setTime((UDate)(time_cont.get(i)*1000.0), status);
+      cal->setTime(t, status);
       STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
 
       status = U_ZERO_ERROR;
@@ -160,9 +321,160 @@ SEXP stri_datetime_add(SEXP time, SEXP value, SEXP units, SEXP tz, SEXP locale)
 }
 
 
+#define STRI__FIELDS_NUM 14
+#define STRI__GREGORIAN_MIN_DAYS (-140618)  /* 1585-01-01, after the cutover */
+#define STRI__GREGORIAN_MAX_DAYS (2932896)  /* 9999-12-31 */
+
+
+/** Number of days in a given year of the Gregorian calendar
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static inline int stri__gregorian_year_length(int y)
+{
+   return (y%4 == 0 && (y%100 != 0 || y%400 == 0)) ? 366 : 365;
+}
+
+
+/** Week number of a day in a year or a month,
+ * as in ICU's Calendar::weekNumber()
+ *
+ * @param day day of the period, 1-based
+ * @param day_of_week 1 (Sunday) - 7 (Saturday)
+ * @param first_day_of_week as in Calendar::getFirstDayOfWeek()
+ * @param min_days as in Calendar::getMinimalDaysInFirstWeek()
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static int stri__gregorian_week_number(int day, int day_of_week,
+   int first_day_of_week, int min_days)
+{
+   int start = (day_of_week - first_day_of_week - day + 1)%7;
+   if (start < 0) start += 7;
+   int week = (day + start - 1)/7;
+   if ((7 - start) >= min_days) ++week;
+   return week;
+}
+
+
+/** Compute the date fields of stri_datetime_fields() arithmetically,
+ * as in ICU's GregorianCalendar::handleComputeFields() and
+ * Calendar::computeWeekFields()
+ *
+ * Valid for days after the Julian-Gregorian cutover only.
+ *
+ * @param days days since 1970-01-01 (local time)
+ * @param first_day_of_week as in Calendar::getFirstDayOfWeek()
+ * @param min_days as in Calendar::getMinimalDaysInFirstWeek()
+ * @param fields [out] array of size STRI__FIELDS_NUM; only date fields are set
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static void stri__gregorian_date_fields(int days,
+   int first_day_of_week, int min_days, int* fields)
+{
+   int year, month, day;
+   stri__civil_from_days(days, year, month, day);
+   int day_of_week = (days+4)%7; // 1970-01-01 was a Thursday
+   if (day_of_week < 0) day_of_week += 7;
+   ++day_of_week; // 1 - Sunday
+   int day_of_year = days - stri__days_from_civil(year, 1, 1) + 1;
+
+   int rel_dow = (day_of_week + 7 - first_day_of_week)%7;
+   int rel_dow_jan1 = (day_of_week - day_of_year + 7001 - first_day_of_week)%7;
+   int week_of_year = (day_of_year - 1 + rel_dow_jan1)/7;
+   if ((7 - rel_dow_jan1) >= min_days)
+      ++week_of_year;
+
+   if (week_of_year == 0) { // the last week of the previous year
+      week_of_year = stri__gregorian_week_number(
+         day_of_year + stri__gregorian_year_length(year-1), day_of_week,
+         first_day_of_week, min_days);
+   }
+   else {
+      int last_doy = stri__gregorian_year_length(year);
+      if (day_of_year >= last_doy-5) { // maybe the first week of the next year
+         int last_rel_dow = (rel_dow + last_doy - day_of_year)%7;
+         if (last_rel_dow < 0) last_rel_dow += 7;
+         if ((6 - last_rel_dow) >= min_days && (day_of_year + 7 - rel_dow) > last_doy)
+            week_of_year = 1;
+      }
+   }
+
+   fields[0]  = year;
+   fields[1]  = month;
+   fields[2]  = day;
+   fields[7]  = week_of_year;
+   fields[8]  = stri__gregorian_week_number(day, day_of_week, first_day_of_week, min_days);
+   fields[9]  = day_of_year;
+   fields[10] = day_of_week;
+   fields[13] = 2; // AD + 1
+}
+
+
+/** Get all the fields of stri_datetime_fields() from a Calendar
+ *
+ * @param cal calendar
+ * @param time milliseconds since the epoch
+ * @param fields [out] array of size STRI__FIELDS_NUM
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static void stri__calendar_fields(Calendar* cal, UDate time, int* fields)
+{
+   UErrorCode status = U_ZERO_ERROR;
+   cal->setTime(time, status);
+   STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+
+   for (R_len_t j=0; j<STRI__FIELDS_NUM; ++j) {
+      UCalendarDateFields units_field;
+      switch (j) {
+         case 0:  units_field = UCAL_EXTENDED_YEAR;          break;
+         case 1:  units_field = UCAL_MONTH;                  break;
+         case 2:  units_field = UCAL_DAY_OF_MONTH;           break;
+         case 3:  units_field = UCAL_HOUR_OF_DAY;            break;
+         case 4:  units_field = UCAL_MINUTE;                 break;
+         case 5:  units_field = UCAL_SECOND;                 break;
+         case 6:  units_field = UCAL_MILLISECOND;            break;
+         case 7:  units_field = UCAL_WEEK_OF_YEAR;           break;
+         case 8:  units_field = UCAL_WEEK_OF_MONTH;          break;
+         case 9:  units_field = UCAL_DAY_OF_YEAR;            break;
+         case 10: units_field = UCAL_DAY_OF_WEEK;            break;
+         case 11: units_field = UCAL_HOUR;                   break;
+         case 12: units_field = UCAL_AM_PM;                  break;
+         case 13: units_field = UCAL_ERA;                    break;
+         default: throw StriException(MSG__INCORRECT_MATCH_OPTION, "units");
+      }
+      //UCAL_IS_LEAP_MONTH
+      //UCAL_MILLISECONDS_IN_DAY -> SecondsInDay
+
+      // UCAL_AM_PM -> "AM" or "PM" (localized? or factor?+index in stri_datetime_symbols) add arg use_symbols????
+      // UCAL_DAY_OF_WEEK -> (localized? or factor?) SUNDAY, MONDAY
+      // UCAL_DAY_OF_YEAR '
+
+      // isWekend
+
+      status = U_ZERO_ERROR;
+      fields[j] = cal->get(units_field, status);
+      STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+
+      if (units_field == UCAL_MONTH)      ++fields[j]; // month + 1
+      else if (units_field == UCAL_AM_PM) ++fields[j]; // ampm + 1
+      else if (units_field == UCAL_ERA)   ++fields[j]; // era + 1
+   }
+}
+
+
 /**
  * Get values of date-time fields
  *
+ * The date fields depend only on the local day, so they are
+ * recomputed only when the day changes (e.g., for sorted data).
+ * The time of the day is determined arithmetically, just like in
+ * Calendar::computeFields(), with UTC offsets from a precomputed
+ * transition table. In time zones with a fixed UTC offset,
+ * the Gregorian calendar fields are computed without ICU.
+ *
  * @param time
  * @param locale
  * @param tz
@@ -171,6 +483,9 @@ SEXP stri_datetime_add(SEXP time, SEXP value, SEXP units, SEXP tz, SEXP locale)
  *
  * @version 0.5-1 (Marek Gagolewski, 2015-01-01)
  * @version 0.5-1 (Marek Gagolewski, 2015-03-03) tz arg added
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    use stri__calendar_create; day-level caching, arithmetic path for
+ *    fixed-offset time zones; use StriTimeZoneOffsets
  */
 SEXP stri_datetime_fields(SEXP time, SEXP tz, SEXP locale) {
    PROTECT(time = stri_prepare_arg_POSIXct(time, "time"));
@@ -184,66 +499,68 @@ SEXP stri_datetime_fields(SEXP time, SEXP tz, SEXP locale) {
    R_len_t vectorize_length = LENGTH(time);
    StriContainerDouble time_cont(time, vectorize_length);
 
+   cal = stri__calendar_create(locale_val, *tz_val, true);
+
    UErrorCode status = U_ZERO_ERROR;
-   cal = Calendar::createInstance(locale_val, status);
+   const TimeZone& cal_tz = cal->getTimeZone();
+   int32_t fixed_offset = 0;
+   bool fixed = stri__timezone_fixed_offset(cal_tz, fixed_offset);
+   bool gregorian = (strcmp(cal->getType(), "gregorian") == 0);
+   int first_day_of_week = (int)cal->getFirstDayOfWeek(status);
    STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+   int min_days = (int)cal->getMinimalDaysInFirstWeek();
 
-   cal->adoptTimeZone(tz_val);
-   tz_val = NULL; /* The Calendar takes ownership of the TimeZone. */
+   double time_from = 0.0, time_to = -1.0; // no transitions needed
+   if (!fixed)
+      stri__time_range_ms(time, time_from, time_to);
+   StriTimeZoneOffsets tz_offsets(cal_tz, time_from, time_to);
 
    SEXP ret;
-#define STRI__FIELDS_NUM 14
    STRI__PROTECT(ret = Rf_allocVector(VECSXP, STRI__FIELDS_NUM));
-   for (R_len_t j=0; j<STRI__FIELDS_NUM; ++j)
+   int* ret_fields[STRI__FIELDS_NUM];
+   for (R_len_t j=0; j<STRI__FIELDS_NUM; ++j) {
       SET_VECTOR_ELT(ret, j, Rf_allocVector(INTSXP, vectorize_length));
+      ret_fields[j] = INTEGER(VECTOR_ELT(ret, j));
+   }
 
+   int fields[STRI__FIELDS_NUM];
+   double cur_days = NA_REAL; // local day the date fields in `fields` refer to
    for (R_len_t i=0; i<vectorize_length; ++i) {
       if (time_cont.isNA(i)) {
          for (R_len_t j=0; j<STRI__FIELDS_NUM; ++j)
-            INTEGER(VECTOR_ELT(ret, j))[i] = NA_INTEGER;
+            ret_fields[j][i] = NA_INTEGER;
          continue;
       }
 
-      status = U_ZERO_ERROR;
-      cal->setTime((UDate)(time_cont.get(i)*1000.0), status);
-      STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-
-      for (R_len_t j=0; j<STRI__FIELDS_NUM; ++j) {
-         UCalendarDateFields units_field;
-         switch (j) {
-            case 0:  units_field = UCAL_EXTENDED_YEAR;          break;
-            case 1:  units_field = UCAL_MONTH;                  break;
-            case 2:  units_field = UCAL_DAY_OF_MONTH;           break;
-            case 3:  units_field = UCAL_HOUR_OF_DAY;            break;
-            case 4:  units_field = UCAL_MINUTE;                 break;
-            case 5:  units_field = UCAL_SECOND;                 break;
-            case 6:  units_field = UCAL_MILLISECOND;            break;
-            case 7:  units_field = UCAL_WEEK_OF_YEAR;           break;
-            case 8:  units_field = UCAL_WEEK_OF_MONTH;          break;
-            case 9:  units_field = UCAL_DAY_OF_YEAR;            break;
-            case 10: units_field = UCAL_DAY_OF_WEEK;            break;
-            case 11: units_field = UCAL_HOUR;                   break;
-            case 12: units_field = UCAL_AM_PM;                  break;
-            case 13: units_field = UCAL_ERA;                    break;
-            default: throw StriException(MSG__INCORRECT_MATCH_OPTION, "units");
+      UDate t = (UDate)(time_cont.get(i)*1000.0);
+      if (!(fabs(t) < STRI__TIME_MAX_MILLIS)) { // Inf etc.
+         stri__calendar_fields(cal, t, fields);
+         cur_days = NA_REAL;
+      }
+      else {
+         int32_t offset = (fixed) ? fixed_offset : tz_offsets.getOffset(t);
+
+         double local = t + (double)offset;
+         double days = floor(local/86400000.0);
+         if (days != cur_days) { // also if cur_days is NA
+            if (fixed && gregorian && days >= STRI__GREGORIAN_MIN_DAYS && days <= STRI__GREGORIAN_MAX_DAYS)
+               stri__gregorian_date_fields((int)days, first_day_of_week, min_days, fields);
+            else
+               stri__calendar_fields(cal, t, fields);
+            cur_days = days;
          }
-         //UCAL_IS_LEAP_MONTH
-         //UCAL_MILLISECONDS_IN_DAY -> SecondsInDay
-
-         // UCAL_AM_PM -> "AM" or "PM" (localized? or factor?+index in stri_datetime_symbols) add arg use_symbols????
-         // UCAL_DAY_OF_WEEK -> (localized? or factor?) SUNDAY, MONDAY
-         // UCAL_DAY_OF_YEAR '
 
-         // isWekend
-
-         status = U_ZERO_ERROR;
-         INTEGER(VECTOR_ELT(ret, j))[i] = cal->get(units_field, status);
-         STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-
-         if (units_field == UCAL_MONTH)      ++INTEGER(VECTOR_ELT(ret, j))[i]; // month + 1
-         else if (units_field == UCAL_AM_PM) ++INTEGER(VECTOR_ELT(ret, j))[i]; // ampm + 1
-         else if (units_field == UCAL_ERA)   ++INTEGER(VECTOR_ELT(ret, j))[i]; // era + 1
+         int32_t millis_in_day = (int32_t)(local - days*86400000.0);
+         fields[3]  = millis_in_day/3600000;     // hour of day
+         fields[4]  = (millis_in_day/60000)%60;  // minute
+         fields[5]  = (millis_in_day/1000)%60;   // second
+         fields[6]  = millis_in_day%1000;        // millisecond
+         fields[11] = fields[3]%12;              // hour
+         fields[12] = fields[3]/12 + 1;          // am/pm + 1
       }
+
+      for (R_len_t j=0; j<STRI__FIELDS_NUM; ++j)
+         ret_fields[j][i] = fields[j];
    }
 
    stri__set_names(ret, STRI__FIELDS_NUM,
@@ -279,6 +596,7 @@ SEXP stri_datetime_fields(SEXP time, SEXP tz, SEXP locale) {
  * @version 0.5-1 (Marek Gagolewski, 2015-01-11) lenient arg added
  * @version 0.5-1 (Marek Gagolewski, 2015-03-02) tz arg added
  * @version 1.1.2 (Marek Gagolewski, 2016-09-30) round() is not C++98
+ * @version 1.1.6 (agent, 2026-10-18) use stri__calendar_create
  */
 SEXP stri_datetime_create(SEXP year, SEXP month, SEXP day, SEXP hour,
    SEXP minute, SEXP second, SEXP lenient, SEXP tz, SEXP locale)
@@ -308,14 +626,9 @@ SEXP stri_datetime_create(SEXP year, SEXP month, SEXP day, SEXP hour,
    StriContainerInteger minute_cont(minute, vectorize_length);
    StriContainerDouble second_cont(second, vectorize_length);
 
-   UErrorCode status = U_ZERO_ERROR;
-   cal = Calendar::createInstance(locale_val, status);
-   STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-
-   cal->setLenient(lenient_val);
+   cal = stri__calendar_create(locale_val, *tz_val, lenient_val);
 
-   cal->adoptTimeZone(tz_val);
-   tz_val = NULL; /* The Calendar takes ownership of the TimeZone. */
+   UErrorCode status = U_ZERO_ERROR;
 
    SEXP ret;
    STRI__PROTECT(ret = Rf_allocVector(REALSXP, vectorize_length));
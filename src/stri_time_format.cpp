@@ -34,9 +34,436 @@
 #include "stri_container_utf16.h"
 #include "stri_container_double.h"
 #include "stri_container_integer.h"
+#include "stri_time_zone.h"
 #include <unicode/calendar.h>
 #include <unicode/gregocal.h>
 #include <unicode/smpdtfmt.h>
+#include <unicode/numsys.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+
+#define STRI__DATEFMT_CACHE_SIZE 4
+
+
+/** A prototype DateFormat with the settings it has been created with
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+struct StriDateFmtCacheEntry {
+   std::string format;
+   std::string locale;
+   DateFormat* proto; ///< NULL if the slot is free
+};
+
+static StriDateFmtCacheEntry stri__datefmt_cache[STRI__DATEFMT_CACHE_SIZE];
+static int stri__datefmt_cache_next = 0; ///< slot to be overwritten next
+
+
+/** Delete all the cached DateFormats, see stri__datefmt_create()
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+void stri__datefmt_cache_cleanup()
+{
+   for (int k=0; k<STRI__DATEFMT_CACHE_SIZE; ++k) {
+      if (stri__datefmt_cache[k].proto) {
+         delete stri__datefmt_cache[k].proto;
+         stri__datefmt_cache[k].proto = NULL;
+      }
+   }
+}
+
+
+/** Create a new DateFormat
+ *
+ * Building pattern and locale symbol data is costly, therefore
+ * prototypes for the most recently used settings are cached
+ * and the caller gets their clones.
+ *
+ * @param format_val one of predefined format styles or
+ *    a SimpleDateFormat pattern
+ * @param locale_val locale ID
+ * @return a new object, to be deleted by the caller
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    common part of stri_datetime_format and stri_datetime_parse
+ */
+static DateFormat* stri__datefmt_create(const char* format_val, const char* locale_val)
+{
+   StriDateFmtCacheEntry* entry = NULL;
+   for (int k=0; k<STRI__DATEFMT_CACHE_SIZE; ++k) {
+      StriDateFmtCacheEntry* cur = &stri__datefmt_cache[k];
+      if (cur->proto && cur->format == format_val && cur->locale == locale_val) {
+         entry = cur;
+         break;
+      }
+   }
+
+   if (!entry) {
+      // "format" may be one of:
+      const char* format_opts[] = {
+         "date_full", "date_long", "date_medium", "date_short",
+         "date_relative_full", "date_relative_long", "date_relative_medium", "date_relative_short",
+         "time_full", "time_long", "time_medium", "time_short",
+         "time_relative_full", "time_relative_long", "time_relative_medium", "time_relative_short",
+         "datetime_full", "datetime_long", "datetime_medium", "datetime_short",
+         "datetime_relative_full", "datetime_relative_long", "datetime_relative_medium", "datetime_relative_short",
+         NULL};
+      int format_cur = stri__match_arg(format_val, format_opts);
+
+      UErrorCode status = U_ZERO_ERROR;
+      DateFormat* proto = NULL;
+      if (format_cur >= 0) {
+         DateFormat::EStyle style = DateFormat::kNone;
+         switch (format_cur % 8) {
+            case 0:  style = DateFormat::kFull; break;
+            case 1:  style = DateFormat::kLong; break;
+            case 2:  style = DateFormat::kMedium; break;
+            case 3:  style = DateFormat::kShort; break;
+            case 4:  style = DateFormat::kFullRelative; break;
+            case 5:  style = DateFormat::kLongRelative; break;
+            case 6:  style = DateFormat::kMediumRelative; break;
+            case 7:  style = DateFormat::kShortRelative; break;
+            default: style = DateFormat::kNone; break;
+         }
+
+         /* ICU 54.1: Relative time styles are not currently supported.  */
+         switch (format_cur / 8) {
+            case 0:
+               proto = DateFormat::createDateInstance(style,
+                  Locale::createFromName(locale_val));
+               break;
+
+            case 1:
+               proto = DateFormat::createTimeInstance(
+                  (DateFormat::EStyle)(style & ~DateFormat::kRelative),
+                  Locale::createFromName(locale_val));
+               break;
+
+            case 2:
+               proto = DateFormat::createDateTimeInstance(style,
+                  (DateFormat::EStyle)(style & ~DateFormat::kRelative),
+                  Locale::createFromName(locale_val));
+               break;
+
+            default:
+               proto = NULL;
+               break;
+
+         }
+      }
+      else
+         proto = new SimpleDateFormat(UnicodeString(format_val), Locale::createFromName(locale_val), status);
+      STRI__CHECKICUSTATUS_THROW(status, { if (proto) delete proto; })
+      if (!proto) throw StriException(MSG__MEM_ALLOC_ERROR);
+
+      entry = &stri__datefmt_cache[stri__datefmt_cache_next];
+      stri__datefmt_cache_next = (stri__datefmt_cache_next+1)%STRI__DATEFMT_CACHE_SIZE;
+      if (entry->proto) delete entry->proto;
+      entry->proto  = proto;
+      entry->format = format_val;
+      entry->locale = locale_val;
+   }
+
+   DateFormat* fmt = (DateFormat*)entry->proto->clone();
+   if (!fmt) throw StriException(MSG__MEM_ALLOC_ERROR);
+   return fmt;
+}
+
+
+#define STRI__ISO8601_MIN_DAYS (-140618)  /* 1585-01-01 */
+#define STRI__ISO8601_MAX_DAYS (2932896)  /* 9999-12-31 */
+#define STRI__ISO8601_BUFSIZE 32
+#define STRI__MS_PER_DAY 86400000.0
+
+
+/** An ISO 8601 / RFC 3339 date-time pattern, see stri__iso8601_spec()
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+struct StriIso8601Spec {
+   bool time;      ///< HH:mm present?
+   char sep;       ///< date-time separator, 'T' or ' '
+   bool seconds;   ///< :ss present?
+   int frac;       ///< number of fractional second digits, 0-3
+   int zone;       ///< 0 - none, 1 - XXX, 2 - literal 'Z'
+   bool fixed;     ///< does the time zone have a fixed UTC offset?
+   int32_t offset; ///< the fixed UTC offset, in ms
+   R_len_t length; ///< number of characters in the output (zone excluded)
+};
+
+
+/** Recognize an ISO 8601 / RFC 3339 date-time pattern
+ *
+ * Supported are \code{yyyy-MM-dd} or \code{uuuu-MM-dd}, optionally followed
+ * by \code{'T'HH:mm} or \code{ HH:mm}, \code{:ss}, \code{.S} (up to 3 digits),
+ * and \code{XXX} or \code{'Z'}.
+ *
+ * @param format SimpleDateFormat pattern
+ * @param spec [out] pattern specification
+ * @return whether \code{format} is supported
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static bool stri__iso8601_spec(const char* format, StriIso8601Spec& spec)
+{
+   const char* p = format;
+   if (strncmp(p, "yyyy-MM-dd", 10) != 0 && strncmp(p, "uuuu-MM-dd", 10) != 0)
+      return false;
+   p += 10;
+   spec.time = false;
+   spec.sep = 0;
+   spec.seconds = false;
+   spec.frac = 0;
+   spec.zone = 0;
+   spec.fixed = false;
+   spec.offset = 0;
+   spec.length = 10;
+
+
+   if (strncmp(p, "'T'HH:mm", 8) == 0) {
+      spec.sep = 'T';
+      p += 8;
+   }
+   else if (strncmp(p, " HH:mm", 6) == 0) {
+      spec.sep = ' ';
+      p += 6;
+   }
+   else
+      return (*p == '\0');
+   spec.time = true;
+   spec.length += 6;
+
+
+   if (strncmp(p, ":ss", 3) == 0) {
+      spec.seconds = true;
+      spec.length += 3;
+      p += 3;
+      if (p[0] == '.' && p[1] == 'S') {
+         ++p;
+         while (*p == 'S' && spec.frac < 3) { ++spec.frac; ++p; }
+         if (*p == 'S') return false;
+         spec.length += 1+spec.frac;
+      }
+   }
+
+
+   if (strcmp(p, "XXX") == 0)
+      spec.zone = 1;
+   else if (strcmp(p, "'Z'") == 0)
+      spec.zone = 2;
+   else if (*p != '\0')
+      return false;
+   return true;
+}
+
+
+/** Write a two-digit number
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static inline void stri__iso8601_put2(char* buf, int v)
+{
+   buf[0] = (char)('0'+v/10);
+   buf[1] = (char)('0'+v%10);
+}
+
+
+/** Format a date-time in the same way as SimpleDateFormat does
+ *
+ * The fields are computed as in Calendar::computeFields(), provided that
+ * the date is in the (proleptic) Gregorian calendar.
+ *
+ * @param t milliseconds since the epoch
+ * @param offset UTC offset at \code{t}, in ms
+ * @param spec see stri__iso8601_prepare()
+ * @param buf [out] buffer of size at least STRI__ISO8601_BUFSIZE
+ * @return the number of bytes written or -1 if the year is out of
+ *    the supported range, 1585-9999, or the offset cannot be
+ *    output by XXX (then the caller should rely on ICU)
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static R_len_t stri__iso8601_format(UDate t, int32_t offset,
+   const StriIso8601Spec& spec, char* buf)
+{
+   if (spec.zone == 1 && offset%60000 != 0)
+      return -1; // XXX would output seconds
+
+   double local = t + (double)offset;
+   double days = floor(local/STRI__MS_PER_DAY);
+   if (!(days >= STRI__ISO8601_MIN_DAYS && days <= STRI__ISO8601_MAX_DAYS))
+      return -1; // also NaN, +-Inf
+   int32_t ms = (int32_t)(local - days*STRI__MS_PER_DAY);
+   int y, m, d;
+   stri__civil_from_days((int)days, y, m, d);
+
+
+   stri__iso8601_put2(buf, y/100);
+   stri__iso8601_put2(buf+2, y%100);
+   buf[4] = '-';
+   stri__iso8601_put2(buf+5, m);
+   buf[7] = '-';
+   stri__iso8601_put2(buf+8, d);
+   R_len_t k = 10;
+   if (spec.time) {
+      buf[k++] = spec.sep;
+      stri__iso8601_put2(buf+k, ms/3600000);
+      buf[k+2] = ':';
+      stri__iso8601_put2(buf+k+3, (ms/60000)%60);
+      k += 5;
+      if (spec.seconds) {
+         buf[k] = ':';
+         stri__iso8601_put2(buf+k+1, (ms/1000)%60);
+         k += 3;
+         if (spec.frac > 0) {
+            int frac = ms%1000;
+            buf[k++] = '.';
+            buf[k++] = (char)('0'+frac/100);
+            if (spec.frac > 1) buf[k++] = (char)('0'+(frac/10)%10);
+            if (spec.frac > 2) buf[k++] = (char)('0'+frac%10);
+         }
+      }
+   }
+
+
+   if (spec.zone == 2 || (spec.zone == 1 && offset == 0))
+      buf[k++] = 'Z';
+   else if (spec.zone == 1) {
+      int32_t off = (offset < 0) ? -offset : offset;
+      buf[k++] = (offset < 0) ? '-' : '+';
+      stri__iso8601_put2(buf+k, off/3600000);
+      buf[k+2] = ':';
+      stri__iso8601_put2(buf+k+3, (off/60000)%60);
+      k += 5;
+   }
+   return k;
+}
+
+
+/** Read a two-digit number
+ *
+ * @return -1 on error
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static inline int stri__iso8601_get2(const char* s)
+{
+   if (s[0] < '0' || s[0] > '9' || s[1] < '0' || s[1] > '9')
+      return -1;
+   return (s[0]-'0')*10 + (s[1]-'0');
+}
+
+
+/** Parse a date-time in the same way as SimpleDateFormat does
+ *
+ * Only strings that match the pattern exactly and represent valid
+ * dates are accepted, so that lenient and strict parsing agree.
+ * As in ICU, the time fields not present in the pattern are taken from
+ * the current time of the calendar.
+ *
+ * @param s string
+ * @param n number of bytes
+ * @param spec see stri__iso8601_prepare(); the time zone must have
+ *    a fixed UTC offset
+ * @param now_fields hour, minute, second, and millisecond of the current time
+ * @param t [out] milliseconds since the epoch
+ * @return false if \code{s} should rather be parsed by ICU
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static bool stri__iso8601_parse(const char* s, R_len_t n, const StriIso8601Spec& spec,
+   const int32_t* now_fields, UDate& t)
+{
+   if (n != spec.length + ((spec.zone == 2) ? 1 : 0))
+      return false;
+
+
+   int y1 = stri__iso8601_get2(s), y2 = stri__iso8601_get2(s+2);
+   int m = stri__iso8601_get2(s+5), d = stri__iso8601_get2(s+8);
+   if (y1 < 0 || y2 < 0 || s[4] != '-' || s[7] != '-' || m < 1 || m > 12 || d < 1)
+      return false;
+   int y = y1*100+y2;
+   if (y < 1585) return false;
+   static const int mdays[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+   bool leap = (y%4 == 0 && (y%100 != 0 || y%400 == 0));
+   if (d > mdays[m-1] + ((m == 2 && leap) ? 1 : 0))
+      return false;
+
+
+   int32_t hour = now_fields[0], minute = now_fields[1],
+      second = now_fields[2], millis = now_fields[3];
+   R_len_t k = 10;
+   if (spec.time) {
+      if (s[k] != spec.sep || s[k+3] != ':') return false;
+      hour = stri__iso8601_get2(s+k+1);
+      minute = stri__iso8601_get2(s+k+4);
+      if (hour < 0 || hour > 23 || minute < 0 || minute > 59) return false;
+      k += 6;
+      if (spec.seconds) {
+         if (s[k] != ':') return false;
+         second = stri__iso8601_get2(s+k+1);
+         if (second < 0 || second > 59) return false;
+         k += 3;
+         if (spec.frac > 0) {
+            if (s[k] != '.') return false;
+            millis = 0;
+            for (int j=1; j<=3; ++j) {
+               millis *= 10;
+               if (j > spec.frac) continue;
+               if (s[k+j] < '0' || s[k+j] > '9') return false;
+               millis += s[k+j]-'0';
+            }
+            k += 1+spec.frac;
+         }
+      }
+   }
+   if (spec.zone == 2 && s[k] != 'Z')
+      return false;
+
+
+   t = stri__days_from_civil(y, m, d)*STRI__MS_PER_DAY
+      + (double)(((hour*60 + minute)*60 + second)*1000 + millis)
+      - (double)spec.offset;
+   return true;
+}
+
+
+/** Check whether a date-time format can be handled by
+ * stri__iso8601_format() and stri__iso8601_parse()
+ *
+ * This requires an ISO 8601 pattern, the Gregorian calendar,
+ * and ASCII digits. Whether the time zone has a fixed UTC offset
+ * is noted in \code{spec}.
+ *
+ * @param spec [out]
+ * @param format_val format
+ * @param locale_val locale
+ * @param cal calendar
+ * @return true if the fast path may be used
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static bool stri__iso8601_prepare(StriIso8601Spec& spec, const char* format_val,
+   const char* locale_val, const Calendar* cal)
+{
+   if (!stri__iso8601_spec(format_val, spec))
+      return false;
+   if (strcmp(cal->getType(), "gregorian") != 0)
+      return false;
+   spec.fixed = stri__timezone_fixed_offset(cal->getTimeZone(), spec.offset);
+
+
+   UErrorCode status = U_ZERO_ERROR;
+   NumberingSystem* ns = NumberingSystem::createInstance(
+      Locale::createFromName(locale_val), status);
+   bool latn = (U_SUCCESS(status) && ns && !ns->isAlgorithmic()
+      && strcmp(ns->getName(), "latn") == 0);
+   if (ns) delete ns;
+   return latn;
+}
 
 
 /**
@@ -53,81 +480,34 @@
  *
  * @version 0.5-1 (Marek Gagolewski, 2015-02-22)
  *    use tz
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    use stri__datefmt_create and stri__calendar_create; ISO 8601 fast path
+ *    (any time zone, see StriTimeZoneOffsets)
  */
 SEXP stri_datetime_format(SEXP time, SEXP format, SEXP tz, SEXP locale) {
    PROTECT(time = stri_prepare_arg_POSIXct(time, "time"));
    const char* locale_val = stri__prepare_arg_locale(locale, "locale", true);
    const char* format_val = stri__prepare_arg_string_1_notNA(format, "format");
 
-   // "format" may be one of:
-   const char* format_opts[] = {
-      "date_full", "date_long", "date_medium", "date_short",
-      "date_relative_full", "date_relative_long", "date_relative_medium", "date_relative_short",
-      "time_full", "time_long", "time_medium", "time_short",
-      "time_relative_full", "time_relative_long", "time_relative_medium", "time_relative_short",
-      "datetime_full", "datetime_long", "datetime_medium", "datetime_short",
-      "datetime_relative_full", "datetime_relative_long", "datetime_relative_medium", "datetime_relative_short",
-      NULL};
-   int format_cur = stri__match_arg(format_val, format_opts);
-
    TimeZone* tz_val = stri__prepare_arg_timezone(tz, "tz", true/*allowdefault*/);
    Calendar* cal = NULL;
    DateFormat* fmt = NULL;
    STRI__ERROR_HANDLER_BEGIN(1)
    R_len_t vectorize_length = LENGTH(time);
    StriContainerDouble time_cont(time, vectorize_length);
-   UnicodeString format_str(format_val);
+   fmt = stri__datefmt_create(format_val, locale_val);
+   cal = stri__calendar_create(locale_val, *tz_val, true);
 
    UErrorCode status = U_ZERO_ERROR;
-   if (format_cur >= 0) {
-      DateFormat::EStyle style = DateFormat::kNone;
-      switch (format_cur % 8) {
-         case 0:  style = DateFormat::kFull; break;
-         case 1:  style = DateFormat::kLong; break;
-         case 2:  style = DateFormat::kMedium; break;
-         case 3:  style = DateFormat::kShort; break;
-         case 4:  style = DateFormat::kFullRelative; break;
-         case 5:  style = DateFormat::kLongRelative; break;
-         case 6:  style = DateFormat::kMediumRelative; break;
-         case 7:  style = DateFormat::kShortRelative; break;
-         default: style = DateFormat::kNone; break;
-      }
-
-      /* ICU 54.1: Relative time styles are not currently supported.  */
-      switch (format_cur / 8) {
-         case 0:
-            fmt = DateFormat::createDateInstance(style,
-               Locale::createFromName(locale_val));
-            break;
-
-         case 1:
-            fmt = DateFormat::createTimeInstance(
-               (DateFormat::EStyle)(style & ~DateFormat::kRelative),
-               Locale::createFromName(locale_val));
-            break;
-
-         case 2:
-            fmt = DateFormat::createDateTimeInstance(style,
-               (DateFormat::EStyle)(style & ~DateFormat::kRelative),
-               Locale::createFromName(locale_val));
-            break;
-
-         default:
-            fmt = NULL;
-            break;
-
-      }
-   }
-   else
-      fmt = new SimpleDateFormat(format_str, Locale::createFromName(locale_val), status);
-   STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
 
-   status = U_ZERO_ERROR;
-   cal = Calendar::createInstance(locale_val, status);
-   STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-
-   cal->adoptTimeZone(tz_val);
-   tz_val = NULL; /* The Calendar takes ownership of the TimeZone. */
+   StriIso8601Spec iso_spec;
+   bool iso = stri__iso8601_prepare(iso_spec, format_val, locale_val, cal);
+   char iso_buf[STRI__ISO8601_BUFSIZE];
+   double iso_from = 0.0, iso_to = -1.0; // no transitions needed
+   if (iso && !iso_spec.fixed)
+      stri__time_range_ms(time, iso_from, iso_to);
+   StriTimeZoneOffsets iso_offsets(cal->getTimeZone(), iso_from, iso_to);
 
    SEXP ret;
    STRI__PROTECT(ret = Rf_allocVector(STRSXP, vectorize_length));
@@ -137,6 +517,16 @@ SEXP stri_datetime_format(SEXP time, SEXP format, SEXP tz, SEXP locale) {
          continue;
       }
 
+      if (iso && fabs(time_cont.get(i)*1000.0) < STRI__TIME_MAX_MILLIS) {
+         UDate t = (UDate)(time_cont.get(i)*1000.0);
+         int32_t offset = (iso_spec.fixed) ? iso_spec.offset : iso_offsets.getOffset(t);
+         R_len_t k = stri__iso8601_format(t, offset, iso_spec, iso_buf);
+         if (k >= 0) {
+            SET_STRING_ELT(ret, i, Rf_mkCharLenCE(iso_buf, k, CE_UTF8));
+            continue;
+         }
+      }
+
       status = U_ZERO_ERROR;
       cal->setTime((UDate)(time_cont.get(i)*1000.0), status);
       STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
@@ -178,6 +568,8 @@ SEXP stri_datetime_format(SEXP time, SEXP format, SEXP tz, SEXP locale) {
  * @version 0.5-1 (Marek Gagolewski, 2015-01-11) lenient arg added
  * @version 0.5-1 (Marek Gagolewski, 2015-02-22) use tz
  * @version 0.5-1 (Marek Gagolewski, 2015-03-01) set tzone attrib on retval
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    use stri__datefmt_create and stri__calendar_create; ISO 8601 fast path
  */
 SEXP stri_datetime_parse(SEXP str, SEXP format, SEXP lenient, SEXP tz, SEXP locale) {
    PROTECT(str = stri_prepare_arg_string(str, "str"));
@@ -187,94 +579,75 @@ SEXP stri_datetime_parse(SEXP str, SEXP format, SEXP lenient, SEXP tz, SEXP loca
    if (!isNull(tz)) PROTECT(tz = stri_prepare_arg_string_1(tz, "tz"));
    else             PROTECT(tz); /* needed to set tzone attrib */
 
-   // "format" may be one of:
-   const char* format_opts[] = {
-      "date_full", "date_long", "date_medium", "date_short",
-      "date_relative_full", "date_relative_long", "date_relative_medium", "date_relative_short",
-      "time_full", "time_long", "time_medium", "time_short",
-      "time_relative_full", "time_relative_long", "time_relative_medium", "time_relative_short",
-      "datetime_full", "datetime_long", "datetime_medium", "datetime_short",
-      "datetime_relative_full", "datetime_relative_long", "datetime_relative_medium", "datetime_relative_short",
-      NULL};
-   int format_cur = stri__match_arg(format_val, format_opts);
-
    TimeZone* tz_val = stri__prepare_arg_timezone(tz, "tz", true/*allowdefault*/);
    Calendar* cal = NULL;
    DateFormat* fmt = NULL;
    STRI__ERROR_HANDLER_BEGIN(2)
    R_len_t vectorize_length = LENGTH(str);
-   StriContainerUTF16 str_cont(str, vectorize_length);
-   UnicodeString format_str(format_val);
+   fmt = stri__datefmt_create(format_val, locale_val);
+   cal = stri__calendar_create(locale_val, *tz_val, lenient_val);
 
+   // fields not present in the format are taken from the calendar,
+   // i.e., from the current date-time -- as in a freshly created Calendar
+   UDate now = Calendar::getNow();
    UErrorCode status = U_ZERO_ERROR;
-   if (format_cur >= 0) {
-      DateFormat::EStyle style = DateFormat::kNone;
-      switch (format_cur % 8) {
-         case 0:  style = DateFormat::kFull; break;
-         case 1:  style = DateFormat::kLong; break;
-         case 2:  style = DateFormat::kMedium; break;
-         case 3:  style = DateFormat::kShort; break;
-         case 4:  style = DateFormat::kFullRelative; break;
-         case 5:  style = DateFormat::kLongRelative; break;
-         case 6:  style = DateFormat::kMediumRelative; break;
-         case 7:  style = DateFormat::kShortRelative; break;
-         default: style = DateFormat::kNone; break;
-      }
-
-      /* ICU 54.1: Relative time styles are not currently supported.  */
-      switch (format_cur / 8) {
-         case 0:
-            fmt = DateFormat::createDateInstance(style, Locale::createFromName(locale_val));
-            break;
-
-         case 1:
-            fmt = DateFormat::createTimeInstance((DateFormat::EStyle)(style & ~DateFormat::kRelative),
-               Locale::createFromName(locale_val));
-            break;
-
-         case 2:
-            fmt = DateFormat::createDateTimeInstance(style,
-               (DateFormat::EStyle)(style & ~DateFormat::kRelative),
-               Locale::createFromName(locale_val));
-            break;
-
-         default:
-            fmt = NULL;
-            break;
-
-      }
-   }
-   else
-      fmt = new SimpleDateFormat(format_str, Locale::createFromName(locale_val), status);
-   STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-
-   status = U_ZERO_ERROR;
-   cal = Calendar::createInstance(locale_val, status);
+   cal->setTime(now, status);
    STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
 
-   cal->adoptTimeZone(tz_val);
-   tz_val = NULL; /* The Calendar takes ownership of the TimeZone. */
-
-   cal->setLenient(lenient_val);
+   StriIso8601Spec iso_spec;
+   bool iso = stri__iso8601_prepare(iso_spec, format_val, locale_val, cal);
+   int32_t now_fields[4];
+   if (iso) {
+      if (!iso_spec.fixed) iso = false; // local times may be ambiguous
+      if (iso_spec.zone == 1) iso = false; // parsed offsets are not supported
+      double now_local = now + (double)iso_spec.offset;
+      int32_t now_ms = (int32_t)(now_local - floor(now_local/STRI__MS_PER_DAY)*STRI__MS_PER_DAY);
+      now_fields[0] = now_ms/3600000;
+      now_fields[1] = (now_ms/60000)%60;
+      now_fields[2] = (now_ms/1000)%60;
+      now_fields[3] = now_ms%1000;
+   }
 
    SEXP ret;
    STRI__PROTECT(ret = Rf_allocVector(REALSXP, vectorize_length));
+   double* ret_val = REAL(ret);
+
+   // 1st pass: ISO 8601 strings, if applicable
+   std::vector<bool> todo(vectorize_length, true);
+   bool any_todo = false;
    for (R_len_t i=0; i<vectorize_length; ++i) {
-      if (str_cont.isNA(i)) {
-         REAL(ret)[i] = NA_REAL;
-         continue;
+      SEXP curs = STRING_ELT(str, i);
+      UDate t;
+      if (curs == NA_STRING) {
+         ret_val[i] = NA_REAL;
+         todo[i] = false;
       }
+      else if (iso && (IS_ASCII(curs) || IS_UTF8(curs)) &&
+            stri__iso8601_parse(CHAR(curs), LENGTH(curs), iso_spec, now_fields, t)) {
+         ret_val[i] = ((double)t)/1000.0;
+         todo[i] = false;
+      }
+      else
+         any_todo = true;
+   }
 
-      status = U_ZERO_ERROR;
-      ParsePosition pos;
-      fmt->parse(str_cont.get(i), *cal, pos);
+   // 2nd pass: ICU
+   if (any_todo) {
+      StriContainerUTF16 str_cont(str, vectorize_length);
+      for (R_len_t i=0; i<vectorize_length; ++i) {
+         if (!todo[i]) continue;
 
-      if (pos.getErrorIndex() >= 0)
-         REAL(ret)[i] = NA_REAL;
-      else {
          status = U_ZERO_ERROR;
-         REAL(ret)[i] = ((double)cal->getTime(status))/1000.0;
-         if (U_FAILURE(status)) REAL(ret)[i] = NA_REAL;
+         ParsePosition pos;
+         fmt->parse(str_cont.get(i), *cal, pos);
+
+         if (pos.getErrorIndex() >= 0)
+            ret_val[i] = NA_REAL;
+         else {
+            status = U_ZERO_ERROR;
+            ret_val[i] = ((double)cal->getTime(status))/1000.0;
+            if (U_FAILURE(status)) ret_val[i] = NA_REAL;
+         }
       }
    }
 
@@ -32,8 +32,156 @@
 
 #include "stri_stringi.h"
 #include "stri_container_utf8.h"
+#include "stri_time_zone.h"
 #include <unicode/strenum.h>
+#include <unicode/basictz.h>
+#include <unicode/tztrans.h>
+#include <unicode/tzrule.h>
 #include <string>
+#include <algorithm>
+
+
+/** Check if a time zone has a constant UTC offset
+ *
+ * This is the case for, e.g., UTC, Etc/GMT+3, or GMT+05:30, but not
+ * for Asia/Tokyo (a few transitions in the 1940s) or for any zone
+ * that observes daylight saving time.
+ *
+ * @param tz time zone
+ * @param offset [out] the offset in milliseconds, if true is returned
+ * @return whether the offset is constant
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+bool stri__timezone_fixed_offset(const TimeZone& tz, int32_t& offset)
+{
+   if (tz.useDaylightTime())
+      return false;
+
+   const BasicTimeZone* btz = dynamic_cast<const BasicTimeZone*>(&tz);
+   if (!btz)
+      return false;
+
+   TimeZoneTransition trans;
+   if (btz->getNextTransition(-1.0e16 /* ca. 315,000 BC */, FALSE, trans))
+      return false;
+
+   offset = tz.getRawOffset();
+   return true;
+}
+
+
+#define STRI__TIMEZONE_MAX_TRANSITIONS 100000
+
+
+/** Fetch the transitions of a time zone in a given time range
+ *
+ * If there are too many transitions (e.g., the range spans thousands
+ * of years of daylight saving time), the range is shrunk.
+ *
+ * @param tz time zone, must exist as long as this object
+ * @param from lower bound of the time range (ms since the epoch),
+ *    at least -STRI__TIME_MAX_MILLIS
+ * @param to upper bound, at most STRI__TIME_MAX_MILLIS
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+StriTimeZoneOffsets::StriTimeZoneOffsets(const TimeZone& tz, double from, double to)
+{
+   this->tz = &tz;
+   this->cursor = 0;
+   this->from = 0.0;
+   this->to = -1.0; // empty range
+   if (from < -STRI__TIME_MAX_MILLIS) from = -STRI__TIME_MAX_MILLIS;
+   if (to > STRI__TIME_MAX_MILLIS) to = STRI__TIME_MAX_MILLIS;
+   if (!(from <= to)) return; // also NaN
+
+   int32_t raw_offset, dst_offset;
+   UErrorCode status = U_ZERO_ERROR;
+   tz.getOffset(from, FALSE, raw_offset, dst_offset, status);
+   if (U_FAILURE(status)) return;
+   offsets.push_back(raw_offset+dst_offset);
+   this->from = from;
+   this->to = to;
+
+   const BasicTimeZone* btz = dynamic_cast<const BasicTimeZone*>(&tz);
+   if (!btz) {
+      this->to = from; // only the first offset is known
+      return;
+   }
+
+   TimeZoneTransition trans;
+   double base = from;
+   while (btz->getNextTransition(base, FALSE, trans)) {
+      base = trans.getTime();
+      if (base > to) break;
+      if (times.size() >= STRI__TIMEZONE_MAX_TRANSITIONS) {
+         this->to = times.back(); // offsets after `base` are not known
+         break;
+      }
+      const TimeZoneRule* rule = trans.getTo();
+      times.push_back(base);
+      offsets.push_back(rule->getRawOffset()+rule->getDSTSavings());
+   }
+}
+
+
+/** Get the UTC offset at a given time
+ *
+ * @param t milliseconds since the epoch, less than STRI__TIME_MAX_MILLIS
+ *    in magnitude
+ * @return raw offset + DST offset, in milliseconds, just like
+ *    TimeZone::getOffset() with local=FALSE
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+int32_t StriTimeZoneOffsets::getOffset(double t)
+{
+   if (!(t >= from && t <= to)) {
+      int32_t raw_offset, dst_offset;
+      UErrorCode status = U_ZERO_ERROR;
+      tz->getOffset(t, FALSE, raw_offset, dst_offset, status);
+      if (U_FAILURE(status))
+         throw StriException(status);
+      return raw_offset+dst_offset;
+   }
+
+   size_t n = times.size();
+   // most likely: same interval as before or the next one
+   if ((cursor == 0 || times[cursor-1] <= t) && (cursor == n || t < times[cursor]))
+      return offsets[cursor];
+   if (cursor < n && times[cursor] <= t && (cursor+1 == n || t < times[cursor+1]))
+      return offsets[++cursor];
+
+   cursor = (size_t)(std::upper_bound(times.begin(), times.end(), t) - times.begin());
+   return offsets[cursor];
+}
+
+
+/** Get the range of (reasonable) date-time values
+ *
+ * @param time POSIXct (numeric vector)
+ * @param from [out] minimum, in milliseconds since the epoch
+ * @param to [out] maximum; \code{from > to} if there are no finite values
+ *    (values greater than STRI__TIME_MAX_MILLIS in magnitude are ignored)
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+void stri__time_range_ms(SEXP time, double& from, double& to)
+{
+   from = 0.0;
+   to = -1.0;
+   bool first = true;
+   R_len_t n = LENGTH(time);
+   const double* time_val = REAL(time);
+   for (R_len_t i=0; i<n; ++i) {
+      double t = time_val[i]*1000.0;
+      if (!(fabs(t) < STRI__TIME_MAX_MILLIS)) continue; // also NA, Inf
+      if (first) { from = to = t; first = false; }
+      else if (t < from) from = t;
+      else if (t > to) to = t;
+   }
+}
 
 
 /** List available time zone IDs
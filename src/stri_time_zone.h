@@ -0,0 +1,80 @@
+/* This file is part of the 'stringi' package for R.
+ * Copyright (c) 2013-2017, Marek Gagolewski and other contributors.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#ifndef __stri_time_zone_h
+#define __stri_time_zone_h
+
+#include <vector>
+#include <unicode/timezone.h>
+
+
+/* |time| in ms that may be handled without ICU; Calendar clamps larger
+ * values, and TimeZone::getOffset() must not be called on them */
+#define STRI__TIME_MAX_MILLIS 1.0e17
+
+
+/**
+ * UTC offsets of a time zone in a given time range
+ *
+ * The transitions are fetched from ICU only once, so that
+ * offsets of many time points can be determined quickly:
+ * sequentially, if the time points are (nearly) sorted,
+ * or via binary search otherwise. Outside the covered range,
+ * TimeZone::getOffset() is called.
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+class StriTimeZoneOffsets {
+   private:
+      const TimeZone* tz;           // not owned
+      double from;                  // covered range [from, to], ms since the epoch
+      double to;
+      std::vector<double> times;    // transition times, sorted
+      std::vector<int32_t> offsets; // offsets[k] is in effect in [times[k-1], times[k])
+      size_t cursor;                // index into offsets of the last lookup
+
+      StriTimeZoneOffsets(const StriTimeZoneOffsets&); // no copy
+      StriTimeZoneOffsets& operator=(const StriTimeZoneOffsets&);
+
+   public:
+      StriTimeZoneOffsets(const TimeZone& tz, double from, double to);
+
+      int32_t getOffset(double t);
+
+      /** Number of transitions in the covered range */
+      size_t getTransitionCount() const { return times.size(); }
+};
+
+void stri__time_range_ms(SEXP time, double& from, double& to);
+
+#endif
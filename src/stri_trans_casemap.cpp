@@ -35,6 +35,62 @@
 #include "stri_string8buf.h"
 #include "stri_brkiter.h"
 #include <unicode/ucasemap.h>
+#include <unicode/uloc.h>
+#include <cstring>
+
+
+/** the high bit set in each byte of a 64-bit word */
+static const uint64_t STRI__CASEMAP_HIGHBITS =
+   ((uint64_t)0x80808080 << 32) | (uint64_t)0x80808080;
+
+/** 0x01 in each byte of a 64-bit word */
+static const uint64_t STRI__CASEMAP_ONES =
+   ((uint64_t)0x01010101 << 32) | (uint64_t)0x01010101;
+
+
+/** Convert the case of an ASCII string [internal]
+ *
+ * Processes 8 bytes at a time (SWAR): for each byte b < 0x80,
+ * b + (0x80-first) has its high bit set iff b >= first,
+ * and b + (0x80-last-1) has its high bit set iff b > last,
+ * which gives us a mask of the letters to be changed;
+ * the case is flipped by toggling bit 0x20.
+ *
+ * @param s ASCII string
+ * @param n number of bytes in s
+ * @param out [out] buffer of size at least n
+ * @param lower convert to lower case (or to upper case)?
+ * @return whether any character has been changed
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static bool stri__casemap_ascii(const char* s, R_len_t n, char* out, bool lower)
+{
+   const uint8_t first = lower?'A':'a';
+   const uint8_t last  = lower?'Z':'z';
+   const uint64_t add_first = (uint64_t)(0x80-first)*STRI__CASEMAP_ONES;
+   const uint64_t add_last  = (uint64_t)(0x80-last-1)*STRI__CASEMAP_ONES;
+
+   uint64_t changed = 0;
+   R_len_t i = 0;
+   for (; i+8 <= n; i += 8) {
+      uint64_t w;
+      memcpy(&w, s+i, 8);
+      uint64_t mask = (w+add_first) & ~(w+add_last) & STRI__CASEMAP_HIGHBITS;
+      changed |= mask;
+      w ^= (mask >> 2); // 0x80 -> 0x20
+      memcpy(out+i, &w, 8);
+   }
+   for (; i < n; ++i) {
+      uint8_t c = (uint8_t)s[i];
+      if (c >= first && c <= last) {
+         c ^= 0x20;
+         changed = 1;
+      }
+      out[i] = (char)c;
+   }
+   return (changed != 0);
+}
 
 
 /**
@@ -166,6 +222,9 @@ SEXP stri_trans_totitle(SEXP str, SEXP opts_brkiter) {
  *
  * @version 0.6-1 (Marek Gagolewski, 2015-07-11)
  *    now this is an internal function
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    ASCII fast path, unchanged ASCII strings are not re-created
 */
 SEXP stri_trans_casemap(SEXP str, int _type, SEXP locale)
 {
@@ -181,6 +240,14 @@ SEXP stri_trans_casemap(SEXP str, int _type, SEXP locale)
    ucasemap = ucasemap_open(qloc, U_FOLD_CASE_DEFAULT, &status);
    STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
 
+   // ASCII letters are mapped in a locale-independent way,
+   // except for Turkish and Azeri (dotted and dotless i)
+   char lang[ULOC_LANG_CAPACITY];
+   status = U_ZERO_ERROR;
+   uloc_getLanguage(ucasemap_getLocale(ucasemap), lang, ULOC_LANG_CAPACITY, &status);
+   bool use_ascii = (U_SUCCESS(status) && status != U_STRING_NOT_TERMINATED_WARNING
+      && strcmp(lang, "tr") != 0 && strcmp(lang, "az") != 0);
+
    R_len_t str_n = LENGTH(str);
    StriContainerUTF8 str_cont(str, str_n);
    SEXP ret;
@@ -209,6 +276,14 @@ SEXP stri_trans_casemap(SEXP str, int _type, SEXP locale)
       R_len_t str_cur_n     = str_cont.get(i).length();
       const char* str_cur_s = str_cont.get(i).c_str();
 
+      if (use_ascii && str_cont.get(i).isASCII()) {
+         if (stri__casemap_ascii(str_cur_s, str_cur_n, buf.data(), _type == 1))
+            SET_STRING_ELT(ret, i, Rf_mkCharLenCE(buf.data(), str_cur_n, CE_UTF8));
+         else
+            SET_STRING_ELT(ret, i, STRING_ELT(str, i)); // nothing changed
+         continue;
+      }
+
       status = U_ZERO_ERROR;
       int buf_need;
       if (_type == 1) buf_need = ucasemap_utf8ToLower(ucasemap,
@@ -32,6 +32,8 @@
 #include "stri_stringi.h"
 #include "stri_container_utf16.h"
 #include <unicode/normalizer2.h>
+#include <string>
+#include <vector>
 
 
 #define STRI_UNINORM_NFC 10
@@ -94,6 +96,64 @@ const Normalizer2* stri__normalizer_get(int _type)
 }
 
 
+/** Get the smallest code point which is not stable under a given normalization form
+ *
+ * Code points below this value have NF*_Quick_Check=Yes and
+ * Canonical_Combining_Class=0, hence each string consisting only of such
+ * code points is already normalized. For NFKC_Casefold,
+ * the ASCII capital letters must additionally be excluded.
+ *
+ * @param _type normalization type, as in stri__normalizer_get()
+ * @return code point
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+UChar32 stri__normalizer_min_unstable(int _type)
+{
+   switch (_type) {
+      case STRI_UNINORM_NFC:
+         return 0x0300; // COMBINING GRAVE ACCENT
+      case STRI_UNINORM_NFD:
+         return 0x00C0; // LATIN CAPITAL LETTER A WITH GRAVE
+      default: /* NFKC, NFKD, NFKC_CF */
+         return 0x00A0; // NO-BREAK SPACE
+   }
+}
+
+
+/** Quick check for whether a UTF-8 string is normalized
+ *
+ * @param s UTF-8 string
+ * @param n number of bytes
+ * @param min_unstable see stri__normalizer_min_unstable()
+ * @param casefold is this NFKC_Casefold?
+ * @return true if \code{s} is valid UTF-8 which is surely normalized,
+ *    false if it is not known (or \code{s} is not valid UTF-8)
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+bool stri__normalizer_quick_check_utf8(const char* s, R_len_t n,
+   UChar32 min_unstable, bool casefold)
+{
+   R_len_t j = 0;
+   UChar32 c;
+   while (j < n) {
+      c = (uint8_t)s[j];
+      if (c < 0x80) {
+         ++j;
+         if (casefold && c >= (UChar32)'A' && c <= (UChar32)'Z')
+            return false;
+         continue;
+      }
+
+      U8_NEXT(s, j, n, c);
+      if (c < 0 || c >= min_unstable)
+         return false;
+   }
+   return true;
+}
+
+
 /**
  * Perform Unicode Normalization
  *
@@ -117,6 +177,11 @@ const Normalizer2* stri__normalizer_get(int _type)
  *
  * @version 0.6-1 (Marek Gagolewski, 2015-07-11)
  *    This is now an internal function
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    UTF-8 quick check; use spanQuickCheckYes and normalize only
+ *    the tail of a string; return the original CHARSXPs
+ *    of already-normalized UTF-8 and ASCII strings
  */
 SEXP stri_trans_nf(SEXP str, int type)
 {
@@ -131,23 +196,72 @@ SEXP stri_trans_nf(SEXP str, int type)
 
    const Normalizer2* normalizer =
       stri__normalizer_get(type); // auto `type` check here, call before ERROR_HANDLER
+   UChar32 min_unstable = stri__normalizer_min_unstable(type);
+   bool casefold = (type == STRI_UNINORM_NFKC_CF);
 
    PROTECT(str = stri_prepare_arg_string(str, "str"));    // prepare string argument
    R_len_t str_length = LENGTH(str);
 
    STRI__ERROR_HANDLER_BEGIN(1)
-   StriContainerUTF16 str_cont(str, str_length, false); // writable, no recycle
+   SEXP ret;
+   STRI__PROTECT(ret = Rf_allocVector(STRSXP, str_length));
+
+   // 1st pass: strings that are surely normalized need no conversion at all
+   std::vector<bool> todo(str_length, false);
+   bool any_todo = false;
+   for (R_len_t i=0; i<str_length; ++i) {
+      SEXP curs = STRING_ELT(str, i);
+      if (curs == NA_STRING) {
+         SET_STRING_ELT(ret, i, NA_STRING);
+      }
+      else if ((IS_ASCII(curs) || IS_UTF8(curs)) &&
+            stri__normalizer_quick_check_utf8(CHAR(curs), LENGTH(curs),
+               min_unstable, casefold)) {
+         SET_STRING_ELT(ret, i, curs);
+      }
+      else {
+         todo[i] = true;
+         any_todo = true;
+      }
+   }
 
+   if (!any_todo) {
+      STRI__UNPROTECT_ALL
+      return ret;
+   }
+
+   // 2nd pass: normalize only what follows the longest normalized prefix
+   StriContainerUTF16 str_cont(str, str_length);
+   UnicodeString out;
    for (R_len_t i=0; i<str_length; ++i) {
-      if (str_cont.isNA(i)) continue;
+      if (!todo[i]) continue;
+      const UnicodeString* curs = &str_cont.get(i);
+
       UErrorCode status = U_ZERO_ERROR;
-      str_cont.set(i, normalizer->normalize(str_cont.get(i), status));
+      int32_t span = normalizer->spanQuickCheckYes(*curs, status);
       STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+
+      if (span == curs->length()) {
+         SEXP origs = STRING_ELT(str, i);
+         if (IS_ASCII(origs) || IS_UTF8(origs))
+            SET_STRING_ELT(ret, i, origs);
+         else
+            SET_STRING_ELT(ret, i, str_cont.toR(i)); // assure UTF-8
+         continue;
+      }
+
+      out.setTo(*curs, 0, span);
+      normalizer->normalizeSecondAndAppend(out, curs->tempSubString(span), status);
+      STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
+
+      std::string outs;
+      out.toUTF8String(outs);
+      SET_STRING_ELT(ret, i, Rf_mkCharLenCE(outs.c_str(), (int)outs.length(), CE_UTF8));
    }
 
    // normalizer shall not be deleted at all
    STRI__UNPROTECT_ALL
-   return str_cont.toR();
+   return ret;
    STRI__ERROR_HANDLER_END(;/* nothing special to be done on error */)
 }
 
@@ -173,30 +287,49 @@ SEXP stri_trans_nf(SEXP str, int type)
  *
  * @version 0.6-1 (Marek Gagolewski, 2015-07-11)
  *    This is now an internal function
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    UTF-8 quick check; UTF-16 conversion only if needed
  */
 SEXP stri_trans_isnf(SEXP str, int type)
 {
    const Normalizer2* normalizer =
       stri__normalizer_get(type); // auto `type` check here, call before ERROR_HANDLER
+   UChar32 min_unstable = stri__normalizer_min_unstable(type);
+   bool casefold = (type == STRI_UNINORM_NFKC_CF);
 
    PROTECT(str = stri_prepare_arg_string(str, "str"));    // prepare string argument
    R_len_t str_length = LENGTH(str);
 
    STRI__ERROR_HANDLER_BEGIN(1)
-   StriContainerUTF16 str_cont(str, str_length);
-
    SEXP ret;
    STRI__PROTECT(ret = Rf_allocVector(LGLSXP, str_length));
    int* ret_tab = LOGICAL(ret);
 
-   for (R_len_t i = str_cont.vectorize_init();
-         i != str_cont.vectorize_end();
-         i = str_cont.vectorize_next(i))
-   {
-      if (str_cont.isNA(i)) {
+   bool any_todo = false;
+   for (R_len_t i=0; i<str_length; ++i) {
+      SEXP curs = STRING_ELT(str, i);
+      if (curs == NA_STRING)
          ret_tab[i] = NA_LOGICAL;
-         continue;
+      else if ((IS_ASCII(curs) || IS_UTF8(curs)) &&
+            stri__normalizer_quick_check_utf8(CHAR(curs), LENGTH(curs),
+               min_unstable, casefold))
+         ret_tab[i] = TRUE;
+      else {
+         ret_tab[i] = FALSE; // to be determined below
+         any_todo = true;
       }
+   }
+
+   if (!any_todo) {
+      STRI__UNPROTECT_ALL
+      return ret;
+   }
+
+   StriContainerUTF16 str_cont(str, str_length);
+   for (R_len_t i=0; i<str_length; ++i) {
+      if (ret_tab[i] != FALSE)
+         continue;
 
       // C API will not be faster here
       // as it is a simple wrapper for C++ API
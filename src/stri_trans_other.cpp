@@ -33,23 +33,26 @@
 #include "stri_stringi.h"
 #include "stri_container_utf8.h"
 #include "stri_string8buf.h"
-#include <deque>
+#include <map>
+#include <vector>
 
 
 /**
- * fill a deque with CHARSXPs == individual code points in s of length n
+ * fill a vector with individual code points in s of length n;
+ * invalid byte sequences are stored as negative values
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    was: stri__split_codepoints, generating CHARSXPs
  */
-void stri__split_codepoints(deque<SEXP>& out, const char* s, int n) {
+void stri__trans_char_codepoints(std::vector<UChar32>& out, const char* s, int n) {
    UChar32 c = 0;
    R_len_t j = 0; // current pos
-   R_len_t i = 0; // last pos
    while (j < n) {
       U8_NEXT(s, j, n, c);
-      out.push_back(Rf_mkCharLenCE(s+i, j-i, CE_UTF8));
+      out.push_back(c);
 
       if (c < 0)
          Rf_warning(MSG__INVALID_UTF8);
-      i = j;
    }
 }
 
@@ -65,7 +68,10 @@ void stri__split_codepoints(deque<SEXP>& out, const char* s, int n) {
  *
  * @version 0.5-1 (Marek Gagolewski, 2015-04-06)
  *
- *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    single-pass translation table (a LUT for ASCII and a map for
+ *    other code points) instead of calling stri_replace_all_fixed
+ *    for each code point; each code point is now translated at most once
  */
 SEXP stri_trans_char(SEXP str, SEXP pattern, SEXP replacement) {
    PROTECT(str          = stri_prepare_arg_string(str, "str"));
@@ -84,41 +90,96 @@ SEXP stri_trans_char(SEXP str, SEXP pattern, SEXP replacement) {
    const String8* s_pat = &pattern_cont.get(0);
    const String8* s_rep = &replacement_cont.get(0);
 
-   deque<SEXP> d_pat;
-   stri__split_codepoints(d_pat, s_pat->c_str(), s_pat->length());
+   std::vector<UChar32> v_pat;
+   stri__trans_char_codepoints(v_pat, s_pat->c_str(), s_pat->length());
 
-   deque<SEXP> d_rep;
-   stri__split_codepoints(d_rep, s_rep->c_str(), s_rep->length());
+   std::vector<UChar32> v_rep;
+   stri__trans_char_codepoints(v_rep, s_rep->c_str(), s_rep->length());
 
-   R_len_t m = std::min(d_rep.size(), d_pat.size());
-   if (d_pat.size() != d_rep.size()) {
+   R_len_t m = (R_len_t)std::min(v_rep.size(), v_pat.size());
+   if (v_pat.size() != v_rep.size()) {
       Rf_warning(MSG__WARN_RECYCLING_RULE);
    }
 
+   R_len_t str_len = LENGTH(str);
+   StriContainerUTF8 str_cont(str, str_len);
+
    if (m == 0) { // nothing to do
-      StriContainerUTF8 str_cont(str, LENGTH(str));
       STRI__UNPROTECT_ALL
       return str_cont.toR(); // assure UTF-8
    }
 
-
-   SEXP new_pattern;
-   SEXP new_replacement;
-   STRI__PROTECT(new_pattern = Rf_allocVector(STRSXP, m));
-   STRI__PROTECT(new_replacement = Rf_allocVector(STRSXP, m));
-   deque<SEXP>::iterator it1 = d_pat.begin();
-   deque<SEXP>::iterator it2 = d_rep.begin();
-   for (R_len_t i=0; i<m; ++i) {
-      SET_STRING_ELT(new_pattern,     i, *it1++);
-      SET_STRING_ELT(new_replacement, i, *it2++);
+   // build the translation table; if a code point occurs more than once
+   // in the pattern, the last corresponding replacement is used
+   UChar32 ascii_map[128];
+   for (UChar32 c=0; c<128; ++c)
+      ascii_map[c] = c;
+   std::map<UChar32, UChar32> other_map;
+   R_len_t max_rep_len = 1; // max UTF-8 length of a replacement code point
+   for (R_len_t k=0; k<m; ++k) {
+      if (v_pat[k] < 0 || v_rep[k] < 0)
+         continue; // invalid UTF-8, already warned about
+      if (v_pat[k] < 128)
+         ascii_map[v_pat[k]] = v_rep[k];
+      else
+         other_map[v_pat[k]] = v_rep[k];
+      if ((R_len_t)U8_LENGTH(v_rep[k]) > max_rep_len)
+         max_rep_len = (R_len_t)U8_LENGTH(v_rep[k]);
    }
 
+   // each code point of byte length l is replaced by one
+   // of byte length at most l*max_rep_len
+   R_len_t bufsize = 0;
+   for (R_len_t i=0; i<str_len; ++i) {
+      if (str_cont.isNA(i))
+         continue;
 
-   SEXP ret;
-   STRI__PROTECT(ret = stri_replace_all_fixed(str, new_pattern, new_replacement,
-      /*vectorize_all*/Rf_ScalarLogical(FALSE), /*opts_fixed*/R_NilValue)
-   )
+      R_len_t cursize = str_cont.get(i).length();
+      if (cursize > bufsize)
+         bufsize = cursize;
+   }
+   String8buf buf(bufsize*max_rep_len);
 
+   SEXP ret;
+   STRI__PROTECT(ret = Rf_allocVector(STRSXP, str_len));
+
+   for (R_len_t i=0; i<str_len; ++i) {
+      if (str_cont.isNA(i)) {
+         SET_STRING_ELT(ret, i, NA_STRING);
+         continue;
+      }
+
+      R_len_t str_cur_n = str_cont.get(i).length();
+      const char* str_cur_s = str_cont.get(i).c_str();
+      char* out = buf.data();
+
+      R_len_t j = 0, k = 0;
+      UChar32 c;
+      while (j < str_cur_n) {
+         c = (uint8_t)str_cur_s[j];
+         if (c < 128) {
+            ++j;
+            c = ascii_map[c];
+            if (c < 128) {
+               out[k++] = (char)c;
+               continue;
+            }
+         }
+         else {
+            U8_NEXT(str_cur_s, j, str_cur_n, c);
+            if (c < 0)
+               throw StriException(MSG__INVALID_UTF8);
+            if (!other_map.empty()) {
+               std::map<UChar32, UChar32>::iterator it = other_map.find(c);
+               if (it != other_map.end())
+                  c = it->second;
+            }
+         }
+         U8_APPEND_UNSAFE(out, k, c);
+      }
+
+      SET_STRING_ELT(ret, i, Rf_mkCharLenCE(out, k, CE_UTF8));
+   }
 
    STRI__UNPROTECT_ALL
    return ret;
@@ -34,7 +34,12 @@
 #include "stri_container_utf16.h"
 #include <unicode/translit.h>
 #include <unicode/strenum.h>
+#include <unicode/uniset.h>
 #include <string>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 
 /** List available transliterators
@@ -86,21 +91,243 @@ SEXP stri_trans_list()
 }
 
 
-/** General text transform with ICU Transliterator
+#define STRI__TRANS_CACHE_SIZE 8
+#define STRI__TRANS_PARALLEL_CHUNK 256
+
+
+/** A prototype Transliterator with the settings it has been created with
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+struct StriTransCacheEntry {
+   UnicodeString id;      ///< transform ID or custom rules
+   bool rules;            ///< is \code{id} a set of custom rules?
+   UTransDirection dir;
+   Transliterator* proto; ///< NULL if the slot is free
+   Transliterator* proto_owned; ///< see stri__trans_create_owned(); NULL if not needed yet
+};
+
+static StriTransCacheEntry stri__trans_cache[STRI__TRANS_CACHE_SIZE];
+static int stri__trans_cache_next = 0; ///< slot to be overwritten next
+
+
+/** Delete all the cached Transliterators, see stri__trans_create()
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+void stri__trans_cache_cleanup()
+{
+   for (int k=0; k<STRI__TRANS_CACHE_SIZE; ++k) {
+      if (stri__trans_cache[k].proto) {
+         delete stri__trans_cache[k].proto;
+         stri__trans_cache[k].proto = NULL;
+      }
+      if (stri__trans_cache[k].proto_owned) {
+         delete stri__trans_cache[k].proto_owned;
+         stri__trans_cache[k].proto_owned = NULL;
+      }
+   }
+}
+
+
+/** Get the rules of a Transliterator [internal]
+ *
+ * Rule-based transliterators are written down as their rule sets,
+ * the other ones by their IDs, see stri__trans_create_owned().
+ *
+ * @param trans Transliterator
+ * @param rules [out] rules are appended here
+ * @param top is \code{trans} the outermost Transliterator?
+ * @param prev_block [in/out] do the rules end with a rule set?
+ * @return false if a filter cannot be expressed in rules
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static bool stri__trans_to_rules(const Transliterator& trans,
+   UnicodeString& rules, bool top, bool& prev_block)
+{
+   UnicodeString filter_pattern;
+   const UnicodeFilter* filter = trans.getFilter();
+   if (filter) {
+      const UnicodeSet* filter_set = dynamic_cast<const UnicodeSet*>(filter);
+      if (!filter_set) return false;
+      filter_set->toPattern(filter_pattern, TRUE);
+   }
+
+   int32_t n = trans.countElements();
+   if (n > 1) { // compound; note that getElement(0) of a 1-element one returns itself
+      if (filter) {
+         if (!top) return false; // the global filter must come first
+         rules += UNICODE_STRING_SIMPLE("::") + filter_pattern + UNICODE_STRING_SIMPLE(";\n");
+      }
+      for (int32_t i=0; i<n; ++i) {
+         UErrorCode status = U_ZERO_ERROR;
+         const Transliterator& elem = trans.getElement(i, status);
+         if (U_FAILURE(status) || !stri__trans_to_rules(elem, rules, false, prev_block))
+            return false;
+      }
+      return true;
+   }
+
+   UnicodeString elem_rules, elem_id;
+   trans.toRules(elem_rules, TRUE);
+   trans.Transliterator::toRules(elem_id, TRUE); // "::ID;"
+   if (elem_rules == elem_id) { // not rule-based, e.g., Any-NFD or Any-Latin
+      if (filter && trans.getID().charAt(0) != (UChar)0x005B /* [ */)
+         elem_rules.insert(2, filter_pattern + UNICODE_STRING_SIMPLE(" "));
+      rules += elem_rules + UNICODE_STRING_SIMPLE("\n");
+      prev_block = false;
+      return true;
+   }
+
+   if (filter) {
+      if (!top) return false;
+      rules += UNICODE_STRING_SIMPLE("::") + filter_pattern + UNICODE_STRING_SIMPLE(";\n");
+   }
+   if (prev_block) // separate passes
+      rules += UNICODE_STRING_SIMPLE("::Null;\n");
+   rules += elem_rules + UNICODE_STRING_SIMPLE("\n");
+   prev_block = true;
+   return true;
+}
+
+
+/** Create a Transliterator that owns all its rule data [internal]
+ *
+ * Rule-based Transliterators created by ID share their (immutable)
+ * rule data with ICU's registry, and so do all their clones.
+ * Such Transliterators lock a global mutex while transliterating, therefore
+ * concurrent threads would in fact process the strings one at a time.
+ * Transliterators created from rules own their data and their clones
+ * get deep copies thereof.
+ *
+ * Hence, we write \code{proto} down as rules and compile them again.
+ * If this is not possible (e.g., a filtered element of a compound
+ * transform), a clone is returned. Note that some non-rule-based
+ * transforms (like Any-Latin) use shared rule-based ones internally
+ * and that some newer ICU versions (e.g., 72) lock the mutex regardless
+ * of who owns the data.
+ *
+ * @param proto Transliterator
+ * @return a new object, to be deleted by the caller
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static Transliterator* stri__trans_create_owned(const Transliterator* proto)
+{
+   UnicodeString rules;
+   bool prev_block = false;
+   if (stri__trans_to_rules(*proto, rules, true, prev_block)) {
+      UErrorCode status = U_ZERO_ERROR;
+      UParseError parseErr;
+      // proto's direction is already reflected in its rules
+      Transliterator* trans = Transliterator::createFromRules(proto->getID(),
+         rules, UTRANS_FORWARD, parseErr, status);
+      if (U_SUCCESS(status) && trans)
+         return trans;
+      if (trans) delete trans;
+   }
+
+   Transliterator* trans = proto->clone();
+   if (!trans) throw StriException(MSG__MEM_ALLOC_ERROR);
+   return trans;
+}
+
+
+/** Create a new Transliterator
+ *
+ * Parsing compound IDs and compiling rule sets is costly, therefore
+ * prototypes for the most recently used settings are cached
+ * and the caller gets their clones.
+ *
+ * @param id transform ID or custom rules
+ * @param rules is \code{id} a set of custom rules?
+ * @param dir direction
+ * @param owned should the object own its rule data so that it may
+ *        be used concurrently with other ones, see stri__trans_create_owned()?
+ * @return a new object, to be deleted by the caller
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+Transliterator* stri__trans_create(const UnicodeString& id, bool rules,
+   UTransDirection dir, bool owned)
+{
+   StriTransCacheEntry* entry = NULL;
+   for (int k=0; k<STRI__TRANS_CACHE_SIZE; ++k) {
+      StriTransCacheEntry* cur = &stri__trans_cache[k];
+      if (cur->proto && cur->rules == rules && cur->dir == dir && cur->id == id) {
+         entry = cur;
+         break;
+      }
+   }
+
+   if (!entry) {
+      UErrorCode status = U_ZERO_ERROR;
+      Transliterator* proto = NULL;
+      if (rules) {
+         // rules referring to other transforms (e.g., ::Upper;) may fail
+         // with U_INVALID_ID if the registry has not been initialized yet
+         Transliterator::countAvailableIDs();
+         UParseError parseErr;
+         proto = Transliterator::createFromRules(UNICODE_STRING_SIMPLE("stringi-rules"),
+            id, dir, parseErr, status);
+      }
+      else
+         proto = Transliterator::createInstance(id, dir, status);
+      STRI__CHECKICUSTATUS_THROW(status, { if (proto) delete proto; })
+      if (!proto) throw StriException(MSG__MEM_ALLOC_ERROR);
+
+      entry = &stri__trans_cache[stri__trans_cache_next];
+      stri__trans_cache_next = (stri__trans_cache_next+1)%STRI__TRANS_CACHE_SIZE;
+      if (entry->proto) delete entry->proto;
+      if (entry->proto_owned) { delete entry->proto_owned; entry->proto_owned = NULL; }
+      entry->proto = proto;
+      entry->id    = id;
+      entry->rules = rules;
+      entry->dir   = dir;
+   }
+
+   if (owned && !entry->proto_owned)
+      entry->proto_owned = stri__trans_create_owned(entry->proto);
+
+   Transliterator* trans = (owned)?entry->proto_owned->clone():entry->proto->clone();
+   if (!trans) throw StriException(MSG__MEM_ALLOC_ERROR);
+   return trans;
+}
+
+
+/** Transliterate each string [internal]
+ *
+ * If the package has been compiled with OpenMP support,
+ * the strings may be transliterated by \code{nthreads} threads,
+ * each using its own copy of the Transliterator
+ * that does not share rule data with the others whenever possible,
+ * see stri__trans_create_owned().
+ * Only UnicodeStrings in the container are modified in parallel;
+ * all the R objects are created on the main thread.
  *
  * @param str character vector
- * @param id single string
+ * @param id single string, transform ID or custom rules
+ * @param rules is \code{id} a set of custom rules?
+ * @param dir direction
+ * @param nthreads single integer
  * @return character vector
  *
- * @version 0.2-2 (Marek Gagolewski, 2014-04-19)
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    common part of stri_trans_general and stri_trans_general_rules
  */
-SEXP stri_trans_general(SEXP str, SEXP id)
+SEXP stri__trans_general(SEXP str, SEXP id, bool rules, UTransDirection dir,
+   SEXP nthreads)
 {
+   int nthreads_val = stri__prepare_arg_integer_1_notNA(nthreads, "nthreads");
+   if (nthreads_val < 1)
+      Rf_error(MSG__EXPECTED_POSITIVE, "nthreads"); // error() allowed here
    PROTECT(str = stri_prepare_arg_string(str, "str"));
-   PROTECT(id  = stri_prepare_arg_string_1(id, "id"));
+   PROTECT(id  = stri_prepare_arg_string_1(id, (rules)?"rules":"id"));
    R_len_t str_length = LENGTH(str);
 
    Transliterator* trans = NULL;
+   std::vector<Transliterator*> trans_thread;
    STRI__ERROR_HANDLER_BEGIN(2)
    StriContainerUTF16  id_cont(id, 1);
    if (id_cont.isNA(0)) {
@@ -108,15 +335,40 @@ SEXP stri_trans_general(SEXP str, SEXP id)
       return stri__vector_NA_strings(str_length);
    }
 
-   UErrorCode status = U_ZERO_ERROR;
-   trans = Transliterator::createInstance(id_cont.get(0), UTRANS_FORWARD, status);
-   STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
-
    StriContainerUTF16 str_cont(str, str_length, false); // writable, no recycle
 
-   for (R_len_t i=0; i<str_length; ++i) {
-      if (str_cont.isNA(i)) continue;
-      trans->transliterate(str_cont.getWritable(i));
+#ifdef _OPENMP
+   if (nthreads_val > str_length/STRI__TRANS_PARALLEL_CHUNK)
+      nthreads_val = str_length/STRI__TRANS_PARALLEL_CHUNK; // not worth it
+   if (nthreads_val > 1) {
+      // a Transliterator must not be used by many threads at a time,
+      // and clones sharing rule data would be serialized by ICU;
+      // all the copies are created here, on the main thread
+      trans_thread.resize(nthreads_val, NULL);
+      for (int t=0; t<nthreads_val; ++t)
+         trans_thread[t] = stri__trans_create(id_cont.get(0), rules, dir, true);
+
+      // each element is processed by exactly one thread, in place,
+      // so the result does not depend on the scheduling
+      #pragma omp parallel for num_threads(nthreads_val) schedule(dynamic, STRI__TRANS_PARALLEL_CHUNK)
+      for (R_len_t i=0; i<str_length; ++i) {
+         if (str_cont.isNA(i)) continue;
+         trans_thread[omp_get_thread_num()]->transliterate(str_cont.getWritable(i));
+      }
+
+      for (int t=0; t<nthreads_val; ++t) {
+         delete trans_thread[t];
+         trans_thread[t] = NULL;
+      }
+   }
+   else
+#endif
+   {
+      trans = stri__trans_create(id_cont.get(0), rules, dir, false);
+      for (R_len_t i=0; i<str_length; ++i) {
+         if (str_cont.isNA(i)) continue;
+         trans->transliterate(str_cont.getWritable(i));
+      }
    }
 
    if (trans) { delete trans; trans = NULL; }
@@ -124,5 +376,44 @@ SEXP stri_trans_general(SEXP str, SEXP id)
    return str_cont.toR();
    STRI__ERROR_HANDLER_END(
       if (trans) { delete trans; trans = NULL; }
+      for (size_t t=0; t<trans_thread.size(); ++t)
+         if (trans_thread[t]) { delete trans_thread[t]; trans_thread[t] = NULL; }
+      std::vector<Transliterator*>().swap(trans_thread); // Rf_error() follows
    )
 }
+
+
+/** General text transform with ICU Transliterator
+ *
+ * @param str character vector
+ * @param id single string
+ * @param nthreads single integer
+ * @return character vector
+ *
+ * @version 0.2-2 (Marek Gagolewski, 2014-04-19)
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    call stri__trans_general, reuse cached Transliterators; nthreads
+ */
+SEXP stri_trans_general(SEXP str, SEXP id, SEXP nthreads)
+{
+   return stri__trans_general(str, id, false, UTRANS_FORWARD, nthreads);
+}
+
+
+/** General text transform with a Transliterator given by custom rules
+ *
+ * @param str character vector
+ * @param rules single string
+ * @param forward single logical value
+ * @param nthreads single integer
+ * @return character vector
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+SEXP stri_trans_general_rules(SEXP str, SEXP rules, SEXP forward, SEXP nthreads)
+{
+   bool forward_val = stri__prepare_arg_logical_1_notNA(forward, "forward");
+   return stri__trans_general(str, rules, true,
+      (forward_val)?UTRANS_FORWARD:UTRANS_REVERSE, nthreads);
+}
@@ -31,6 +31,106 @@
 
 #include "stri_stringi.h"
 #include "stri_ucnv.h"
+#include <string>
+
+
+#define STRI__UCNV_POOL_SIZE 16
+
+
+/** An idle converter, ready to be reused
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+struct StriUcnvPoolEntry {
+   std::string name; ///< canonical converter name, see ucnv_getName()
+   UConverter* ucnv; ///< NULL if the slot is free
+};
+
+static StriUcnvPoolEntry stri__ucnv_pool[STRI__UCNV_POOL_SIZE];
+static int stri__ucnv_pool_next = 0; ///< slot to be overwritten next
+
+
+/** Close all the idle converters in the pool
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+void stri__ucnv_pool_cleanup()
+{
+   for (int k=0; k<STRI__UCNV_POOL_SIZE; ++k) {
+      if (stri__ucnv_pool[k].ucnv) {
+         ucnv_close(stri__ucnv_pool[k].ucnv);
+         stri__ucnv_pool[k].ucnv = NULL;
+      }
+   }
+}
+
+
+/** Take an idle converter out of the pool
+ *
+ * Converters are looked up by their canonical names,
+ * so that e.g. "latin1" and "ISO-8859-1" share pooled converters.
+ *
+ * @param name converter name, NULL for default
+ * @return a converter or NULL if there is none in the pool
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static UConverter* stri__ucnv_pool_acquire(const char* name)
+{
+   // the default converter may change between calls, see stri_enc_set()
+   const char* resolved_name = (name)?name:ucnv_getDefaultName();
+
+   // the first alias is the canonical name (unless it is not an alias at all,
+   // e.g. a name with options; then the lookup fails and a new one is opened)
+   UErrorCode status = U_ZERO_ERROR;
+   const char* canonical_name = ucnv_getAlias(resolved_name, 0, &status);
+   if (U_FAILURE(status) || !canonical_name)
+      canonical_name = resolved_name;
+
+   for (int k=0; k<STRI__UCNV_POOL_SIZE; ++k) {
+      StriUcnvPoolEntry* entry = &stri__ucnv_pool[k];
+      if (entry->ucnv && entry->name == canonical_name) {
+         UConverter* ucnv = entry->ucnv;
+         entry->ucnv = NULL;
+         return ucnv;
+      }
+   }
+   return NULL;
+}
+
+
+/** Put a converter back to the pool
+ *
+ * The converter should be in its initial state, see closeConverter().
+ * If the pool is full, the oldest idle converter is closed.
+ *
+ * @param ucnv converter, the pool takes its ownership
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static void stri__ucnv_pool_release(UConverter* ucnv)
+{
+   UErrorCode status = U_ZERO_ERROR;
+   const char* canonical_name = ucnv_getName(ucnv, &status);
+   if (U_FAILURE(status) || !canonical_name) {
+      ucnv_close(ucnv);
+      return;
+   }
+
+   int k = 0;
+   while (k<STRI__UCNV_POOL_SIZE && stri__ucnv_pool[k].ucnv)
+      ++k;
+
+   if (k == STRI__UCNV_POOL_SIZE) {
+      // the pool is full: overwrite the slots in a round-robin fashion
+      k = stri__ucnv_pool_next;
+      stri__ucnv_pool_next = (stri__ucnv_pool_next+1)%STRI__UCNV_POOL_SIZE;
+      ucnv_close(stri__ucnv_pool[k].ucnv);
+   }
+
+   stri__ucnv_pool[k].name = canonical_name;
+   stri__ucnv_pool[k].ucnv = ucnv;
+}
 
 
 /**
@@ -50,6 +150,9 @@
  *
  * @version 0.4-1 (Marek Gagolewski, 2014-12-01)
  *    don't register callbacks by default
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    reuse an idle converter from the pool if available
  */
 void StriUcnv::openConverter(bool register_callbacks) {
    if (m_ucnv)
@@ -57,10 +160,14 @@ void StriUcnv::openConverter(bool register_callbacks) {
 
    UErrorCode status = U_ZERO_ERROR;
 
-   m_ucnv = ucnv_open(m_name, &status);
-   STRI__CHECKICUSTATUS_THROW(status, { m_ucnv = NULL; })
+   m_ucnv = stri__ucnv_pool_acquire(m_name);
+   if (!m_ucnv) {
+      m_ucnv = ucnv_open(m_name, &status);
+      STRI__CHECKICUSTATUS_THROW(status, { if (m_ucnv) ucnv_close(m_ucnv); m_ucnv = NULL; })
+   }
 
    if (register_callbacks) {
+      m_callbacks = true;
       status = U_ZERO_ERROR;
       ucnv_setFromUCallBack((UConverter*)m_ucnv,
          (UConverterFromUCallback)STRI__UCNV_FROM_U_CALLBACK_SUBSTITUTE_WARN,
@@ -81,6 +188,42 @@ void StriUcnv::openConverter(bool register_callbacks) {
 }
 
 
+/**
+ * Returns the converter to the pool
+ *
+ * The converter is reset and ICU's default substitute callbacks
+ * are restored, so that the next user gets it in its initial state.
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+void StriUcnv::closeConverter() {
+   if (!m_ucnv)
+      return;
+
+   ucnv_reset(m_ucnv);
+
+   if (m_callbacks) {
+      UErrorCode status = U_ZERO_ERROR;
+      ucnv_setFromUCallBack(m_ucnv, UCNV_FROM_U_CALLBACK_SUBSTITUTE,
+         (const void *)NULL, (UConverterFromUCallback *)NULL,
+         (const void **)NULL, &status);
+      if (U_SUCCESS(status))
+         ucnv_setToUCallBack(m_ucnv, UCNV_TO_U_CALLBACK_SUBSTITUTE,
+            (const void *)NULL, (UConverterToUCallback *)NULL,
+            (const void **)NULL, &status);
+      m_callbacks = false;
+      if (U_FAILURE(status)) { // don't throw from a destructor
+         ucnv_close(m_ucnv);
+         m_ucnv = NULL;
+         return;
+      }
+   }
+
+   stri__ucnv_pool_release(m_ucnv);
+   m_ucnv = NULL;
+}
+
+
 /** Returns a desired converted
  *
  * @return UConverter
@@ -45,6 +45,10 @@
  *
  * @version 1.0.6 (Marek Gagolewski, 2017-05-25)
  *    #270 latin-1 is windows-1252 on Windows
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    converters are taken from and returned to a pool,
+ *    see stri_ucnv.cpp
  */
 class StriUcnv  {
 
@@ -54,6 +58,7 @@ class StriUcnv  {
       const char* m_name; // encoding, owned by caller
       int m_isutf8;
       int m_is8bit;
+      bool m_callbacks; // are our own callbacks registered?
 
       static void STRI__UCNV_FROM_U_CALLBACK_SUBSTITUTE_WARN (
                   const void* context,
@@ -73,6 +78,7 @@ class StriUcnv  {
                  UErrorCode* err);
 
       void openConverter(bool register_callbacks);
+      void closeConverter();
 
    public:
 
@@ -82,12 +88,13 @@ class StriUcnv  {
          m_ucnv = NULL; // lazy
          m_isutf8 = NA_LOGICAL;
          m_is8bit = NA_LOGICAL;
+         m_callbacks = false;
       }
 
       ~StriUcnv()
       {
          if (m_ucnv)
-            ucnv_close(m_ucnv);
+            closeConverter();
          m_ucnv = NULL;
       }
 
@@ -97,6 +104,7 @@ class StriUcnv  {
          m_ucnv = NULL;
          m_isutf8 = NA_LOGICAL;
          m_is8bit = NA_LOGICAL;
+         m_callbacks = false;
       }
 
 
@@ -106,6 +114,7 @@ class StriUcnv  {
          m_ucnv = NULL;
          m_isutf8 = NA_LOGICAL;
          m_is8bit = NA_LOGICAL;
+         m_callbacks = false;
          return *this;
       }
 
@@ -0,0 +1,222 @@
+/* This file is part of the 'stringi' package for R.
+ * Copyright (c) 2013-2017, Marek Gagolewski and other contributors.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "stri_stringi.h"
+#include <cstring>
+
+
+/* The kernels below process 8 bytes at a time (SWAR - SIMD within
+ * a register) as long as they are all ASCII. Multibyte sequences are
+ * validated one at a time according to Table 3-7 (Well-Formed UTF-8 Byte
+ * Sequences) of The Unicode Standard, i.e., overlong forms, surrogates,
+ * and code points > U+10FFFF are invalid -- exactly as in the case of
+ * ICU's U8_NEXT, which these functions replace on hot paths.
+ *
+ * Note that we do not use any compiler- or CPU-specific intrinsics here,
+ * as the package is built with portable compiler flags on all platforms.
+ */
+
+
+/** the high bit set in each byte of a 64-bit word */
+static const uint64_t STRI__UTF8_HIGHBITS =
+   ((uint64_t)0x80808080 << 32) | (uint64_t)0x80808080;
+
+
+/** Skip a run of ASCII characters
+ *
+ * @param s string
+ * @param i current position
+ * @param n number of bytes in s
+ * @return position of the first non-ASCII byte at or after i, or n
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static inline R_len_t stri__utf8_skip_ascii(const uint8_t* s, R_len_t i, R_len_t n)
+{
+   while (i+8 <= n) {
+      uint64_t w;
+      memcpy(&w, s+i, 8); // unaligned load, compiled to a single instruction
+      if (w & STRI__UTF8_HIGHBITS) break;
+      i += 8;
+   }
+   while (i < n && s[i] < 0x80)
+      ++i;
+   return i;
+}
+
+
+/** Get the length of a well-formed multibyte UTF-8 sequence
+ *
+ * @param s string
+ * @param i position of a non-ASCII byte
+ * @param n number of bytes in s
+ * @return number of bytes in the sequence (2, 3, or 4)
+ *    or 0 if it is ill-formed
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+static inline R_len_t stri__utf8_seq_length(const uint8_t* s, R_len_t i, R_len_t n)
+{
+   uint8_t c = s[i];
+   if (c < 0xC2) // continuation byte or overlong 2-byte sequence
+      return 0;
+   else if (c < 0xE0) {
+      if (i+1 >= n || (s[i+1] & 0xC0) != 0x80) return 0;
+      return 2;
+   }
+   else if (c < 0xF0) {
+      if (i+2 >= n) return 0;
+      uint8_t t1 = s[i+1];
+      if (c == 0xE0) { if (t1 < 0xA0 || t1 > 0xBF) return 0; } // overlong
+      else if (c == 0xED) { if (t1 < 0x80 || t1 > 0x9F) return 0; } // surrogates
+      else if ((t1 & 0xC0) != 0x80) return 0;
+      if ((s[i+2] & 0xC0) != 0x80) return 0;
+      return 3;
+   }
+   else if (c < 0xF5) {
+      if (i+3 >= n) return 0;
+      uint8_t t1 = s[i+1];
+      if (c == 0xF0) { if (t1 < 0x90 || t1 > 0xBF) return 0; } // overlong
+      else if (c == 0xF4) { if (t1 < 0x80 || t1 > 0x8F) return 0; } // > U+10FFFF
+      else if ((t1 & 0xC0) != 0x80) return 0;
+      if ((s[i+2] & 0xC0) != 0x80 || (s[i+3] & 0xC0) != 0x80) return 0;
+      return 4;
+   }
+   else
+      return 0;
+}
+
+
+/** Count the code points in a UTF-8 string and validate it in one pass
+ *
+ * @param str string
+ * @param n number of bytes in str
+ * @return number of code points or -1 if str is not well-formed UTF-8
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+R_len_t stri__utf8_count_valid(const char* str, R_len_t n)
+{
+   const uint8_t* s = (const uint8_t*)str;
+   R_len_t count = 0;
+   R_len_t i = 0;
+   while (i < n) {
+      R_len_t j = stri__utf8_skip_ascii(s, i, n);
+      count += j-i;
+      i = j;
+      // non-ASCII characters usually come in runs (e.g., in CJK texts):
+      while (i < n && s[i] >= 0x80) {
+         R_len_t len = stri__utf8_seq_length(s, i, n);
+         if (len == 0) return -1;
+         i += len;
+         ++count;
+      }
+   }
+   return count;
+}
+
+
+/** Find the first ill-formed UTF-8 sequence in a string
+ *
+ * @param str string
+ * @param n number of bytes in str
+ * @return byte offset of the first ill-formed sequence
+ *    or -1 if str is well-formed UTF-8
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+R_len_t stri__utf8_find_invalid(const char* str, R_len_t n)
+{
+   const uint8_t* s = (const uint8_t*)str;
+   R_len_t i = 0;
+   while (i < n) {
+      i = stri__utf8_skip_ascii(s, i, n);
+      while (i < n && s[i] >= 0x80) {
+         R_len_t len = stri__utf8_seq_length(s, i, n);
+         if (len == 0) return i;
+         i += len;
+      }
+   }
+   return -1;
+}
+
+
+/** Convert a Latin-1 (ISO-8859-1) string to UTF-8
+ *
+ * Latin-1 bytes map directly onto U+0000..U+00FF,
+ * so no conversion tables are needed.
+ *
+ * @param str string
+ * @param n number of bytes in str
+ * @param out [out] buffer of size at least 2*n
+ * @return number of bytes written to out
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+R_len_t stri__latin1_to_utf8(const char* str, R_len_t n, char* out)
+{
+   const uint8_t* s = (const uint8_t*)str;
+   uint8_t* o = (uint8_t*)out;
+   R_len_t i = 0;
+   R_len_t k = 0;
+   while (i < n) {
+      R_len_t j = stri__utf8_skip_ascii(s, i, n);
+      memcpy(o+k, s+i, (size_t)(j-i));
+      k += j-i;
+      i = j;
+      while (i < n && s[i] >= 0x80) {
+         o[k++] = (uint8_t)(0xC0 | (s[i] >> 6));
+         o[k++] = (uint8_t)(0x80 | (s[i] & 0x3F));
+         ++i;
+      }
+   }
+   return k;
+}
+
+
+/** Convert an ASCII or Latin-1 (ISO-8859-1) string to UTF-16
+ *
+ * Each byte becomes one code unit; this simple loop is vectorized
+ * by the compiler.
+ *
+ * @param str string
+ * @param n number of bytes in str
+ * @param out [out] buffer of size at least n
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ */
+void stri__latin1_to_utf16(const char* str, R_len_t n, UChar* out)
+{
+   const uint8_t* s = (const uint8_t*)str;
+   for (R_len_t i=0; i<n; ++i)
+      out[i] = (UChar)s[i];
+}
@@ -32,6 +32,7 @@
 
 #include "stri_stringi.h"
 #include "stri_container_utf8_indexable.h"
+#include "stri_brkiter.h"
 #include <deque>
 #include <vector>
 #include <utility>
@@ -98,6 +99,12 @@ void stri__wrap_greedy(std::deque<R_len_t>& wrap_after,
  * @version 0.4-1 (Marek Gagolewski, 2014-12-06)
  *    new args: add_para_1, add_para_n,
  *    cost of the last line is zero
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    O(nwords) memory: line costs are computed on the fly from
+ *    cumulative widths, only the lines that fit are considered,
+ *    and the optimal breaks are recovered via backpointers
+ *    (previously: two nwords*nwords matrices)
  */
 void stri__wrap_dynamic(std::deque<R_len_t>& wrap_after,
    R_len_t nwords, int width_val, double exponent_val,
@@ -105,83 +112,69 @@ void stri__wrap_dynamic(std::deque<R_len_t>& wrap_after,
    const std::vector<R_len_t>& widths_trim,
    int add_para_1, int add_para_n)
 {
-#define IDX(i,j) (i)*nwords+(j)
-   vector<double> cost(nwords*nwords);
-   // where cost[IDX(i,j)] == cost of printing words i..j in a single line, i<=j
-
-   // calculate costs:
-   // there is some "punishment" for leaving blanks at the end of each line
-   // (number of "blank" codepoints ^ exponent_val)
-   for (int i=0; i<nwords; i++) {
-      int sum = 0;
-      for (int j=i; j<nwords; j++) {
-         if (j > i) {
-            if (cost[IDX(i,j-1)] < 0.0) { // already Inf
-               cost[IDX(i,j)] = -1.0; // Inf
-               continue;
-            }
-            else {
-               sum -= widths_trim[j-1];
-               sum += widths_orig[j-1];
-            }
-         }
-         sum += widths_trim[j];
-         int ct = width_val - sum;
-         if (i == 0) ct -= add_para_1;
-         else        ct -= add_para_n;
-
-         if (j == nwords-1) { // last line == cost 0
-            if (j == i || ct >= 0)
-               cost[IDX(i,j)] = 0.0;
-            else
-               cost[IDX(i,j)] = -1.0/*Inf*/;
-         }
-         else if (j == i)
-            // some words don't fit in a line at all -> cost 0.0
-            cost[IDX(i,j)] = (ct < 0) ? 0.0 : pow((double)ct, exponent_val);
-         else
-            cost[IDX(i,j)] = (ct < 0) ? -1.0/*"Inf"*/ : pow((double)ct, exponent_val);
-      }
-   }
-
-   vector<double> f(nwords); // f[j] == total cost of  (optimally) printing words 0..j
-   vector<bool> where(nwords*nwords, false); // where[IDX(i,j)] == false iff
-                                             // we don't wrap after i-th word, i<=j
-                                             // when (optimally) printing words 0..j
-
-   for (int j=0; j<nwords; ++j) {
-      if (cost[IDX(0,j)] >= 0.0) {
+   // cumsum_orig[i] == total width of words 0..i-1
+   vector<double> cumsum_orig(nwords+1);
+   cumsum_orig[0] = 0.0;
+   for (R_len_t i=0; i<nwords; ++i)
+      cumsum_orig[i+1] = cumsum_orig[i]+(double)widths_orig[i];
+
+   // the cost of printing words i..j in a single line, i<=j,
+   // is the number of "blank" codepoints at its end ^ exponent_val;
+   // words that don't fit in a line at all have cost 0.0
+   // and the last line costs nothing.
+   // the number of blanks is nonincreasing in j, hence if words
+   // i..j don't fit (Inf cost), neither do i..j+1
+#define STRI__WRAP_BLANKS(i,j) ((double)width_val \
+   - (cumsum_orig[(j)]-cumsum_orig[(i)]+(double)widths_trim[(j)]) \
+   - (double)(((i) == 0) ? add_para_1 : add_para_n))
+
+   vector<double> f(nwords); // f[j] == total cost of (optimally) printing words 0..j
+   vector<R_len_t> wrap_prev(nwords); // wrap_prev[j] == i iff we wrap after the i-th word
+                                      // when (optimally) printing words 0..j
+                                      // (and the preceding wraps are given by wrap_prev[i]);
+                                      // -1 if no wrapping is needed
+
+   for (R_len_t j=0; j<nwords; ++j) {
+      double ct = STRI__WRAP_BLANKS(0,j);
+      if (j == 0 || ct >= 0.0) {
          // no breaking needed: words 0..j fit in one line
-         f[j] = cost[IDX(0,j)];
+         if (j == nwords-1 || ct < 0.0)
+            f[j] = 0.0;
+         else
+            f[j] = pow(ct, exponent_val);
+         wrap_prev[j] = -1;
          continue;
       }
 
-      // let i = optimal way of printing of words 0..i + printing i+1..j
-      int i = 0;
-      while (i <= j) {
-         if (cost[IDX(i+1,j)] >= 0.0) break;
-         ++i;
-      }
+      // let i = optimal way of printing of words 0..i + printing i+1..j;
+      // in case of ties, the smallest i is chosen
+      R_len_t i = j-1;
+      double best_i = -1.0;
+      for (R_len_t k=j-1; k>=0; --k) {
+         ct = STRI__WRAP_BLANKS(k+1,j);
+         double cost_cur;
+         if (k+1 == j)
+            cost_cur = (j == nwords-1 || ct < 0.0) ? 0.0 : pow(ct, exponent_val);
+         else if (ct < 0.0)
+            break; // Inf, so are all the remaining ones
+         else
+            cost_cur = (j == nwords-1) ? 0.0 : pow(ct, exponent_val);
 
-      double best_i = f[i] + cost[IDX(i+1,j)];
-      for (int k=i+1; k<j; ++k) {
-         if (cost[IDX(k+1,j)] < 0.0) continue;
-         double best_cur = f[k] + cost[IDX(k+1,j)];
-         if (best_cur < best_i) {
+         double best_cur = f[k] + cost_cur;
+         if (best_i < 0.0 || best_cur <= best_i) {
             best_i = best_cur;
             i = k;
          }
       }
-      for (int k=0; k<i; ++k)
-         where[IDX(k,j)] = where[IDX(k,i)];
-      where[IDX(i,j)] = true;
+      wrap_prev[j] = i;
       f[j] = best_i;
    }
+#undef STRI__WRAP_BLANKS
 
-   //result is in the last row of where...
-   for (int k=0; k<nwords; ++k)
-      if (where[IDX(k, nwords-1)])
-         wrap_after.push_back(k);
+   std::vector<R_len_t> wrap_rev; // backtrack, from the last line break
+   for (R_len_t k=wrap_prev[nwords-1]; k >= 0; k=wrap_prev[k])
+      wrap_rev.push_back(k);
+   wrap_after.insert(wrap_after.end(), wrap_rev.rbegin(), wrap_rev.rend());
 }
 
 
@@ -241,6 +234,9 @@ struct StriWrapLineStart {
  *
  * @version 0.5-1 (Marek Gagolewski, 2015-06-09)
  *    BIGSKIP: no more CHARSXP on out on "" input
+ *
+ * @version 1.1.6 (agent, 2026-10-18)
+ *    clone a cached line BreakIterator
  */
 SEXP stri_wrap(SEXP str, SEXP width, SEXP cost_exponent,
    SEXP indent, SEXP exdent, SEXP prefix, SEXP initial, SEXP whitespace_only,
@@ -261,7 +257,6 @@ SEXP stri_wrap(SEXP str, SEXP width, SEXP cost_exponent,
 
 
    const char* qloc = stri__prepare_arg_locale(locale, "locale", true); /* this is R_alloc'ed */
-   Locale loc = Locale::createFromName(qloc);
    PROTECT(str     = stri_prepare_arg_string(str, "str"));
    PROTECT(prefix  = stri_prepare_arg_string_1(prefix, "prefix"));
    PROTECT(initial = stri_prepare_arg_string_1(initial, "initial"));
@@ -270,9 +265,8 @@ SEXP stri_wrap(SEXP str, SEXP width, SEXP cost_exponent,
    UText* str_text = NULL;
 
    STRI__ERROR_HANDLER_BEGIN(3)
+   briter = stri__brkiter_create(UBRK_LINE, qloc, UnicodeString());
    UErrorCode status = U_ZERO_ERROR;
-   briter = BreakIterator::createLineInstance(loc, status);
-   STRI__CHECKICUSTATUS_THROW(status, {/* do nothing special on err */})
 
    R_len_t str_length = LENGTH(str);
    StriContainerUTF8_indexable str_cont(str, str_length);